@@ -86,6 +86,106 @@ def two_piece_polynomial_fit(all_data, metric='rmse'):
     return best_thresh, best
 
 
+# Layout of the firmware speed table: fine steps at low power where the
+# sqrt(power) fit curves sharply, coarse steps above. Must match
+# speed_from_deciwatts() in pelomon/speed_table.h.
+TABLE_FINE_STEP_DW = 20
+TABLE_FINE_LIMIT_DW = 640
+TABLE_COARSE_STEP_DW = 160
+TABLE_LIMIT_DW = 20480
+
+
+def predict_speed(power, thresh, coefs_low, coefs_high):
+    # Coefficients in PolynomialFeatures order: 1, p^1/2, p, p^3/2
+    coefs = coefs_low if power < thresh else coefs_high
+    rtpower = power ** 0.5
+    return sum(c * rtpower ** i for i, c in enumerate(coefs))
+
+
+def write_speed_table(path, thresh, coefs_low, coefs_high):
+    """Write pelomon/speed_table.h: a PROGMEM table of speed in
+    hundredths of a mph, sampled from the two-piece fit."""
+    deciwatts = list(range(0, TABLE_FINE_LIMIT_DW, TABLE_FINE_STEP_DW))
+    deciwatts += list(range(TABLE_FINE_LIMIT_DW, TABLE_LIMIT_DW + 1,
+                            TABLE_COARSE_STEP_DW))
+    cmph = [max(0, int(round(100 * predict_speed(dw / 10.0, thresh,
+                                                 coefs_low, coefs_high))))
+            for dw in deciwatts]
+    rows = []
+    for i in range(0, len(cmph), 8):
+        rows.append('    ' + ', '.join('%5d' % v for v in cmph[i:i+8]) + ',')
+    fit_desc = lambda coefs: ' + '.join('%.5f p^%d/2' % (c, i)
+                                        for i, c in enumerate(coefs))
+    with open(path, 'w') as f:
+        f.write(SPEED_TABLE_TEMPLATE % {
+            'thresh': thresh,
+            'low': fit_desc(coefs_low),
+            'high': fit_desc(coefs_high),
+            'fine_step': TABLE_FINE_STEP_DW,
+            'fine_limit': TABLE_FINE_LIMIT_DW,
+            'coarse_step': TABLE_COARSE_STEP_DW,
+            'limit': TABLE_LIMIT_DW,
+            'len': len(cmph),
+            'rows': '\n'.join(rows),
+        })
+
+
+SPEED_TABLE_TEMPLATE = \
+'''/* Power to speed lookup table.
+ *
+ * GENERATED by decoding_speed/regress_speed.py --table; do not edit.
+ * Two-piece fit on watts, split at %(thresh).1fW:
+ *   low:  %(low)s
+ *   high: %(high)s
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _SPEED_TABLE_H_
+#define _SPEED_TABLE_H_
+
+// Samples every %(fine_step)d dW below %(fine_limit)d dW, then every %(coarse_step)d dW up to %(limit)d dW
+#define SPEED_TABLE_FINE_STEP_DW %(fine_step)d
+#define SPEED_TABLE_FINE_LIMIT_DW %(fine_limit)d
+#define SPEED_TABLE_COARSE_STEP_DW %(coarse_step)d
+#define SPEED_TABLE_LIMIT_DW %(limit)dU
+#define SPEED_TABLE_LEN %(len)d
+
+// Speed in hundredths of a mph
+const uint16_t SPEED_TABLE_CMPH[SPEED_TABLE_LEN] PROGMEM = {
+%(rows)s
+};
+
+uint16_t speed_from_deciwatts(const uint16_t power_deciwatts) {
+    // Linear interpolation between the two samples around the power
+    if (power_deciwatts >= SPEED_TABLE_LIMIT_DW)
+        return pgm_read_word(&SPEED_TABLE_CMPH[SPEED_TABLE_LEN - 1]);
+    uint8_t index;
+    uint16_t offset, step;
+    if (power_deciwatts < SPEED_TABLE_FINE_LIMIT_DW) {
+        step = SPEED_TABLE_FINE_STEP_DW;
+        index = power_deciwatts / step;
+        offset = power_deciwatts - index * step;
+    } else {
+        step = SPEED_TABLE_COARSE_STEP_DW;
+        const uint16_t coarse = power_deciwatts - SPEED_TABLE_FINE_LIMIT_DW;
+        index = coarse / step;
+        offset = coarse - index * step;
+        index += SPEED_TABLE_FINE_LIMIT_DW / SPEED_TABLE_FINE_STEP_DW;
+    }
+    const int16_t lo = pgm_read_word(&SPEED_TABLE_CMPH[index]);
+    const int16_t hi = pgm_read_word(&SPEED_TABLE_CMPH[index + 1]);
+    // Slope is bounded by the table, so the product fits in 32 bits
+    return lo + (int16_t) (((int32_t) (hi - lo) * offset + step / 2) / step);
+}
+#endif
+'''
+
+
 def make_plots(rider1, rider2):
     fig = plt.figure()
     plt.subplot(121)
@@ -134,6 +234,12 @@ if __name__ == '__main__':
     mpl.rc('ytick', labelsize=18)
     onefit = polynomial_fit(all_data)
     thresh, twofit = two_piece_polynomial_fit(all_data)
+    if '--table' in sys.argv:
+        # Regenerate the firmware lookup table from this fit
+        table_path = sys.argv[sys.argv.index('--table') + 1]
+        write_speed_table(table_path, thresh,
+                          twofit['model_0'].coef_, twofit['model_1'].coef_)
+        print('Wrote speed table to %s' % table_path)
 
     onefit_desc = ('RMSE %.3f, MAD %.3f, max-error %.3f\n'
                    '%.3f + %.3f $p^{1/2}$ + %.3f $p$ + %.3f $p^{3/2}$' %
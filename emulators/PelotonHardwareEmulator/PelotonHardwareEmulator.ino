@@ -9,7 +9,7 @@
  *        is initialized. Disconnect A5 to send bike bootup sequence. When
  *        blink switches to pattern of 3 rapid blinks, bootup sequence is
  *        complete. Disconnect A0 to start sending message pattern from a
- *        ride. Reconnect A0 to GND to pause ride.
+ *        ride. Reconnect A0 to GND to pause ride and rewind it to the start.
  *        To re-enter bootup sequence, must reset board.
  * 
  * Note: The Arduino Uno outputs 5V and must be connected through a level
@@ -24,6 +24,8 @@
 
 #include <Arduino.h>
 #include <SoftwareSerial.h>
+#include <avr/pgmspace.h>
+#include "ride_trace.h"
 
 // Arbitrary, but corresponds to the HU_RX and BIKE_RX pins on the PeloMon.
 #define PIN_HU_TX 11
@@ -50,6 +52,24 @@
 // directly to PeloMon (after the inverter/level shifter), set to false.
 #define INVERTED_SERIAL true
 
+// If true, ride messages replay the ride recorded in ride_trace.h (see
+// make_ride_trace.py), looping at the end. If false, they cycle a fixed
+// cadence/power/resistance pattern.
+#define PLAY_RIDE_TRACE true
+
+// Run the ride messages this many times faster than real time, from 1 to
+// 10. Bootup messages are always sent at their real rate.
+#define TIME_SCALE 1
+
+// Fault injection for ride messages: on average one in this many bike
+// replies is sent with a bad checksum, or not sent at all. 0 disables.
+#define FAULT_BAD_CHECKSUM_ONE_IN 0
+#define FAULT_DROP_REPLY_ONE_IN 0
+
+#define FAULT_NONE 0
+#define FAULT_BAD_CHECKSUM 1
+#define FAULT_DROP_REPLY 2
+
 
 /* Global state
  *
@@ -64,6 +84,12 @@
  *
  * `led_state`: The LED is kept high during the "bootup" sequence and toggled for
  *              each ride message. Tracks that state.
+ *
+ * `trace_pos`, `trace_row`: byte offset and row number of the next row of the
+ *                           ride trace to be decoded.
+ *
+ * `trace_cadence`, `trace_power`, `trace_resistance`: values from the trace row
+ *                                                     currently being sent.
  */
 SoftwareSerial hu(PIN_HU_RX_PLACEHOLDER, PIN_HU_TX,
                   INVERTED_SERIAL);
@@ -72,6 +98,11 @@ SoftwareSerial bike(PIN_BIKE_RX_PLACEHOLDER, PIN_BIKE_TX,
 unsigned long next_message_time;
 uint8_t next_message;
 bool led_state;
+uint16_t trace_pos;
+uint16_t trace_row;
+uint8_t trace_cadence;
+uint16_t trace_power;
+uint16_t trace_resistance;
 
 /* Synchronously writes a Peloton message on the given interface.
  * 
@@ -80,15 +111,19 @@ bool led_state;
  *
  * `buf_len`: Length of buffer. Must not include two bytes at end for checksum/footer.
  *
+ * `bad_checksum`: If true, send a checksum that is off by one.
+ *
  * Returns the total number of bytes sent.
  */
-uint8_t write_packet(SoftwareSerial& interface, const uint8_t* buf, const uint8_t len) {
+uint8_t write_packet(SoftwareSerial& interface, const uint8_t* buf, const uint8_t len,
+                     const bool bad_checksum) {
     /* Adds checksum and terminating byte */
     uint8_t footer[2] = {0, 0xF6};
     uint8_t bytes_sent;
 
     // Compute checksum byte
     for (uint8_t i=0; i < len; footer[0] += buf[i++]);
+    if (bad_checksum) footer[0]++;
 
     bytes_sent = interface.write(buf, len);
     bytes_sent += interface.write(footer, 2);
@@ -118,20 +153,74 @@ unsigned long wait_until(const unsigned long target_time) {
  * `target_time` param indicates the millis() timestamp at or after which to
  * send the message. If the deadline has already passed, it will send
  * immediately (i.e., timing is best effort)
+ *
+ * `fault` param is one of the FAULT_* values, to corrupt or drop the bike's
+ * reply.
  * 
  * Returns the millisecond timestamp when the HU write started.
  */
 unsigned long write_pair_at(const uint8_t* hu_msg, const uint8_t hu_len,
                             const uint8_t* bike_msg, const uint8_t bike_len,
                             const uint16_t bike_response_latency,
-                            const unsigned long target_time) {
+                            const unsigned long target_time,
+                            const uint8_t fault) {
     unsigned long started_write_at = wait_until(target_time);
-    write_packet(hu, hu_msg, hu_len);
+    write_packet(hu, hu_msg, hu_len, false);
+    if (fault == FAULT_DROP_REPLY) return started_write_at;
     delayMicroseconds(bike_response_latency);
-    write_packet(bike, bike_msg, bike_len);
+    write_packet(bike, bike_msg, bike_len, fault == FAULT_BAD_CHECKSUM);
     return started_write_at;
 }
 
+/* Writes `value` as `digits` ASCII decimal digits, least significant first,
+ * as the bike sends them.
+ */
+void encode_digits(uint8_t* out, uint16_t value, const uint8_t digits) {
+    for (uint8_t i = 0; i < digits; i++) {
+        out[i] = 0x30 + value % 10;
+        value /= 10;
+    }
+}
+
+/* Rewinds ride trace playback to its first row.
+ */
+void rewind_trace() {
+    trace_pos = 0;
+    trace_row = 0;
+    trace_cadence = 0;
+    trace_power = 0;
+    trace_resistance = 0;
+}
+
+/* Decodes the next row of the ride trace into trace_cadence, trace_power and
+ * trace_resistance, starting over after the last row. Each row holds deltas
+ * from the previous one; see make_ride_trace.py for the encoding.
+ */
+void next_trace_row() {
+    if (trace_row == RIDE_TRACE_ROWS) rewind_trace();
+    const uint8_t tag = pgm_read_byte(&RIDE_TRACE[trace_pos++]);
+    // High nibble is a signed cadence delta; -8 escapes to a full byte
+    int8_t cadence_delta = (int8_t) tag >> 4;
+    if (cadence_delta == -8) cadence_delta = (int8_t) pgm_read_byte(&RIDE_TRACE[trace_pos++]);
+    trace_cadence += cadence_delta;
+    switch ((tag >> 2) & 3) {
+        case 1: trace_resistance++; break;
+        case 2: trace_resistance--; break;
+        case 3:
+            trace_resistance += pgm_read_word(&RIDE_TRACE[trace_pos]);
+            trace_pos += 2;
+            break;
+    }
+    switch (tag & 3) {
+        case 1: trace_power += (int8_t) pgm_read_byte(&RIDE_TRACE[trace_pos++]); break;
+        case 2:
+            trace_power += pgm_read_word(&RIDE_TRACE[trace_pos]);
+            trace_pos += 2;
+            break;
+    }
+    trace_row++;
+}
+
 void setup() {
     pinMode(PIN_HU_TX, OUTPUT);
     pinMode(PIN_BIKE_TX, OUTPUT);
@@ -186,14 +275,14 @@ void setup() {
     delay_us = (uint16_t) random(200, 1000);
     sent_at = write_pair_at(hu_init_msg+1, hu_init_msg[0],
                             bike_init_msg+1, bike_init_msg[0],
-                            delay_us, 0);
+                            delay_us, 0, FAULT_NONE);
     next_message_time = sent_at + inter_boot_delay_ms;
 
     // Bike ID message
     delay_us = (uint16_t) random(200, 1000);
     sent_at = write_pair_at(hu_bikeid_msg+1, hu_bikeid_msg[0],
                             bike_bikeid_msg+1, bike_bikeid_msg[0],
-                            delay_us, next_message_time);
+                            delay_us, next_message_time, FAULT_NONE);
     next_message_time = sent_at + inter_boot_delay_ms;
 
     bike_msg[0] = 0xF1; bike_msg[1] = 0xF7; bike_msg[2] = 0x04;
@@ -208,11 +297,12 @@ void setup() {
         bike_msg[6] = 0x30 + (resistance / 1000) % 10;
         delay_us = (uint16_t) random(200, 1000);
         sent_at = write_pair_at(hu_msg, 2, bike_msg, 7, delay_us,
-                                next_message_time);
+                                next_message_time, FAULT_NONE);
         next_message_time = sent_at + inter_boot_delay_ms;
     }
 
     next_message = 0x41;
+    rewind_trace();
     digitalWrite(LED_BUILTIN, LOW);
     led_state = false;
 }
@@ -221,9 +311,11 @@ void loop() {
     // Send the messages observed during a ride
     const unsigned long current_time = millis();
     // Ride-time messages come every 100ms.
-    const uint8_t inter_ride_delay_ms = 100;
+    const uint8_t inter_ride_delay_ms = 100 / TIME_SCALE;
     unsigned long sent_at;
     uint16_t delay_us;
+    uint16_t value;
+    uint8_t fault = FAULT_NONE;
     uint8_t hu_msg[2];
     uint8_t bike_msg[8];
 
@@ -244,6 +336,7 @@ void loop() {
         // a new "ride" as soon as this pin goes high.
         next_message = 0x41;
         next_message_time = 0;
+        rewind_trace();
         // Make the blinks slower when we're paused.
         delay(500);
         return;
@@ -254,37 +347,32 @@ void loop() {
     //  4A: 1614, 326, 866
     //  44: 867, 615, 546
     if (next_message == 0x41) {
-        // Cadence
+        // Cadence, RPM
+        if (PLAY_RIDE_TRACE) next_trace_row();
         bike_msg[2] = 3;
-        uint8_t rpm = 75 + current_time % 10;
-        bike_msg[3] = 0x30 + rpm % 10;
-        bike_msg[4] = 0x30 + rpm / 10;
-        bike_msg[5] = 0x30;
-        delay_us = (uint16_t) random(200, 2700);
+        value = PLAY_RIDE_TRACE ? trace_cadence : 75 + current_time % 10;
         next_message = 0x44;
     } else if (next_message == 0x44) {
-        // Output
+        // Output, 0.1W
         bike_msg[2] = 5;
-        uint8_t power = 150 + current_time % 10;
-        bike_msg[3] = 0x30;
-        bike_msg[4] = 0x30 + power % 10;
-        bike_msg[5] = 0x30 + (power / 10) % 10;
-        bike_msg[6] = 0x30 + power / 100;
-        bike_msg[7] = 0x30;
-        delay_us = (uint16_t) random(200, 2700);
+        value = PLAY_RIDE_TRACE ? trace_power : (150 + current_time % 10) * 10;
         next_message = 0x4A;
-    } else if (next_message == 0x4A) {
+    } else {
         // Raw resistance
         bike_msg[2] = 4;
-        bike_msg[3] = 0x30;
-        bike_msg[4] = 0x36;
-        bike_msg[5] = 0x35;
-        bike_msg[6] = 0x34;
-        delay_us = (uint16_t) random(200, 2700);
+        value = PLAY_RIDE_TRACE ? trace_resistance : 4560;
         next_message = 0x41;
     }
+    encode_digits(bike_msg + 3, value, bike_msg[2]);
+    delay_us = (uint16_t) random(200, 2700) / TIME_SCALE;
+
+    if (FAULT_DROP_REPLY_ONE_IN && random(FAULT_DROP_REPLY_ONE_IN) == 0)
+        fault = FAULT_DROP_REPLY;
+    else if (FAULT_BAD_CHECKSUM_ONE_IN && random(FAULT_BAD_CHECKSUM_ONE_IN) == 0)
+        fault = FAULT_BAD_CHECKSUM;
+
     // Send ride messages
     sent_at = write_pair_at(hu_msg, 2, bike_msg, bike_msg[2]+3, delay_us,
-                            next_message_time);
+                            next_message_time, fault);
     next_message_time = sent_at + inter_ride_delay_ms;
 }
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Compress a recorded ride into a PROGMEM trace for the hardware emulator.
+
+Reads peloton_decoding/example-ride.txt (one line per ride-message triple:
+3 cadence, 5 power and 4 resistance payload bytes, ASCII digits LSB first)
+and writes ride_trace.h, which PelotonHardwareEmulator.ino plays back.
+
+Each row is stored as a change from the previous one, starting from all
+zeros. The first byte of a row is a tag:
+
+    bits 7-4  cadence delta, signed -7..7; -8 means an int8 delta follows
+    bits 3-2  resistance: 0 unchanged, 1 +1, 2 -1, 3 int16 delta follows
+    bits 1-0  power (0.1W): 0 unchanged, 1 int8 delta follows,
+              2 int16 delta follows
+
+Any extra bytes follow in the order cadence, resistance, power. Multi-byte
+deltas are little-endian.
+
+Copyright 2020 Imran S Haque (imran@ihaque.org)
+Licensed under the CC-BY-NC 4.0 license
+(https://creativecommons.org/licenses/by-nc/4.0/).
+"""
+import argparse
+import os
+import struct
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_INPUT = os.path.join(HERE, "..", "..", "peloton_decoding", "example-ride.txt")
+DEFAULT_OUTPUT = os.path.join(HERE, "ride_trace.h")
+
+CADENCE_DIGITS, POWER_DIGITS, RESISTANCE_DIGITS = 3, 5, 4
+
+
+def digits_value(payload):
+    # ASCII decimal, least significant digit first
+    assert all(0x30 <= b <= 0x39 for b in payload), payload
+    return sum((b - 0x30) * 10 ** i for i, b in enumerate(payload))
+
+
+def read_ride(path):
+    rows = []
+    with open(path) as f:
+        for line in f:
+            fields = [int(x, 16) for x in line.split()]
+            if not fields:
+                continue
+            assert len(fields) == CADENCE_DIGITS + POWER_DIGITS + RESISTANCE_DIGITS, line
+            cadence = digits_value(fields[:3])
+            power = digits_value(fields[3:8])
+            resistance = digits_value(fields[8:])
+            rows.append((cadence, power, resistance))
+    return rows
+
+
+def encode_row(prev, row):
+    d_cadence, d_power, d_resistance = (row[i] - prev[i] for i in range(3))
+    extra = b""
+    if -7 <= d_cadence <= 7:
+        tag = (d_cadence & 0x0F) << 4
+    else:
+        assert -128 <= d_cadence <= 127
+        tag = 0x80
+        extra += struct.pack("<b", d_cadence)
+    if d_resistance == 1:
+        tag |= 1 << 2
+    elif d_resistance == -1:
+        tag |= 2 << 2
+    elif d_resistance:
+        tag |= 3 << 2
+        extra += struct.pack("<h", d_resistance)
+    if d_power and -128 <= d_power <= 127:
+        tag |= 1
+        extra += struct.pack("<b", d_power)
+    elif d_power:
+        tag |= 2
+        extra += struct.pack("<h", d_power)
+    return bytes([tag]) + extra
+
+
+def encode_ride(rows):
+    out = bytearray()
+    prev = (0, 0, 0)
+    for row in rows:
+        out += encode_row(prev, row)
+        prev = row
+    return bytes(out)
+
+
+def decode_ride(data, count):
+    # Mirror of the sketch's decoder, to check the encoding round trips
+    rows = []
+    cadence = power = resistance = 0
+    pos = 0
+    for _ in range(count):
+        tag = data[pos]
+        pos += 1
+        d_cadence = (tag >> 4) - 16 if tag & 0x80 else tag >> 4
+        if d_cadence == -8:
+            d_cadence = struct.unpack_from("<b", data, pos)[0]
+            pos += 1
+        code = (tag >> 2) & 3
+        if code == 3:
+            resistance += struct.unpack_from("<h", data, pos)[0]
+            pos += 2
+        else:
+            resistance += (0, 1, -1)[code]
+        code = tag & 3
+        if code == 1:
+            power += struct.unpack_from("<b", data, pos)[0]
+            pos += 1
+        elif code == 2:
+            power += struct.unpack_from("<h", data, pos)[0]
+            pos += 2
+        cadence += d_cadence
+        rows.append((cadence, power, resistance))
+    return rows
+
+
+def write_header(path, data, count, source):
+    with open(path, "w") as f:
+        f.write("/* Generated by make_ride_trace.py from %s; do not edit.\n" % source)
+        f.write(" * %d rows in %d bytes. See make_ride_trace.py for the encoding.\n" %
+                (count, len(data)))
+        f.write(" */\n")
+        f.write("#ifndef _RIDE_TRACE_H_\n#define _RIDE_TRACE_H_\n\n")
+        f.write("#define RIDE_TRACE_ROWS %d\n\n" % count)
+        f.write("const uint8_t RIDE_TRACE[] PROGMEM = {\n")
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n#endif\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", nargs="?", default=DEFAULT_INPUT)
+    parser.add_argument("output", nargs="?", default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    rows = read_ride(args.input)
+    data = encode_ride(rows)
+    assert decode_ride(data, len(rows)) == rows
+    write_header(args.output, data, len(rows), os.path.basename(args.input))
+    print("%d rows, %d bytes" % (len(rows), len(data)))
+
+
+if __name__ == "__main__":
+    main()
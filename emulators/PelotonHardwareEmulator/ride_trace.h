@@ -0,0 +1,834 @@
+/* Generated by make_ride_trace.py from example-ride.txt; do not edit.
+ * 6503 rows in 13139 bytes. See make_ride_trace.py for the encoding.
+ */
+#ifndef _RIDE_TRACE_H_
+#define _RIDE_TRACE_H_
+
+#define RIDE_TRACE_ROWS 6503
+
+const uint8_t RIDE_TRACE[] PROGMEM = {
+    0x0C, 0x94, 0x02, 0x00, 0x00, 0x00, 0x00, 0x81, 0x0F, 0x23, 0x00, 0x08, 0x00, 0x04, 0x00, 0x01,
+    0xFB, 0xD1, 0xF5, 0xE9, 0xF9, 0xE1, 0xFB, 0xF0, 0x01, 0x4C, 0x80, 0x10, 0x00, 0xA5, 0xD0, 0xB9,
+    0xF0, 0xE1, 0xF9, 0xE1, 0xFE, 0x04, 0x00, 0x01, 0x19, 0x70, 0x01, 0x22, 0x68, 0x85, 0x0D, 0x69,
+    0x31, 0x1B, 0x51, 0x30, 0x31, 0x1E, 0x31, 0x21, 0x49, 0x2D, 0x01, 0xFE, 0x31, 0x0B, 0xE1, 0x0C,
+    0xF5, 0xEB, 0x21, 0x17, 0xF9, 0xF2, 0x21, 0x18, 0x01, 0x18, 0x45, 0x1C, 0xF1, 0xF3, 0x20, 0x19,
+    0x27, 0xE1, 0xE4, 0x31, 0x1A, 0x05, 0x0F, 0x11, 0x0D, 0x21, 0x1C, 0x00, 0x19, 0xEF, 0x01, 0x1B,
+    0xE0, 0x11, 0xF3, 0x25, 0x1B, 0x01, 0x03, 0x18, 0x01, 0x0B, 0xF1, 0x0E, 0x01, 0xE4, 0x21, 0x0E,
+    0x15, 0x20, 0x00, 0x19, 0x0A, 0xF0, 0xF1, 0xE4, 0x11, 0xF2, 0xF1, 0x0E, 0xF5, 0xF2, 0xE1, 0xE7,
+    0x08, 0x01, 0xFD, 0x01, 0xF3, 0x05, 0x10, 0xF0, 0x01, 0xF3, 0x29, 0x1B, 0x11, 0x0B, 0x11, 0x0E,
+    0x15, 0x12, 0xF1, 0x1C, 0x21, 0xF1, 0x21, 0x2D, 0x21, 0x1E, 0x10, 0x01, 0xF1, 0xF1, 0xE2, 0xF1,
+    0x0F, 0xE1, 0xD3, 0xE9, 0xF3, 0x11, 0xEE, 0xD1, 0xF2, 0xE1, 0xF2, 0x31, 0x1F, 0xE5, 0xE4, 0xE1,
+    0xE5, 0x39, 0x18, 0x21, 0x2B, 0x01, 0x1C, 0x30, 0x01, 0x0F, 0xF5, 0x03, 0xF9, 0xE2, 0x21, 0xFD,
+    0xF1, 0x0F, 0xF1, 0xF1, 0x01, 0xF3, 0x01, 0x0D, 0xF5, 0x12, 0x01, 0xE4, 0x29, 0x0A, 0x11, 0x0F,
+    0xF0, 0x00, 0x00, 0xF0, 0xF1, 0xE4, 0xF1, 0xF1, 0x01, 0xF2, 0x01, 0x0E, 0xF1, 0xF2, 0x00, 0x00,
+    0xF1, 0xF2, 0x01, 0xF2, 0xF0, 0xE1, 0xF3, 0x10, 0xF1, 0xF2, 0x01, 0xF3, 0xF1, 0x1B, 0x01, 0xE5,
+    0x11, 0xF3, 0x01, 0x1A, 0xF0, 0x11, 0xF3, 0x01, 0x0D, 0x11, 0x0E, 0x11, 0x0D, 0x01, 0x1C, 0x25,
+    0x03, 0x10, 0xF0, 0x09, 0x1A, 0x31, 0x0D, 0x04, 0xE1, 0xE7, 0x11, 0xF2, 0xF0, 0x09, 0x0E, 0x01,
+    0xFD, 0x00, 0x01, 0x1C, 0x11, 0xF3, 0x11, 0xF1, 0x01, 0x1C, 0xE0, 0x11, 0xF3, 0x11, 0x0D, 0xE1,
+    0xE4, 0x11, 0xF2, 0x01, 0x1D, 0xE0, 0x01, 0xE3, 0x10, 0xF4, 0xF1, 0xF5, 0x11, 0x0E, 0xF1, 0x1D,
+    0x29, 0xEE, 0x31, 0x1C, 0x31, 0x3C, 0x21, 0x1D, 0x15, 0x14, 0x21, 0x20, 0x21, 0x0F, 0x19, 0x2C,
+    0x21, 0x10, 0xF5, 0xF0, 0x01, 0x04, 0x00, 0x10, 0xF9, 0xEB, 0x01, 0x11, 0xF1, 0xE0, 0xF5, 0x04,
+    0x00, 0x10, 0x01, 0xF0, 0xF0, 0xF9, 0xFC, 0xF1, 0xF0, 0x00, 0x01, 0xF5, 0xF1, 0xEC, 0x11, 0x1F,
+    0xF9, 0xFB, 0x05, 0xF1, 0x05, 0xF9, 0x01, 0x10, 0xE1, 0xF0, 0x08, 0x09, 0xE7, 0x15, 0x10, 0xF1,
+    0xE6, 0xE0, 0x11, 0xE3, 0xE4, 0xE8, 0x01, 0xF1, 0x09, 0xED, 0x15, 0x0F, 0xF1, 0xF5, 0x15, 0x0F,
+    0x21, 0x12, 0xF8, 0xF1, 0xFD, 0x10, 0x00, 0xF1, 0x0F, 0x11, 0x0E, 0x11, 0xF2, 0x31, 0x0E, 0xF0,
+    0x11, 0x1F, 0xF1, 0xF0, 0xF1, 0xE3, 0x31, 0x2D, 0x01, 0x0F, 0x11, 0x10, 0xF0, 0x10, 0x00, 0x11,
+    0x10, 0x01, 0x24, 0x11, 0xEC, 0x01, 0x0F, 0x21, 0x11, 0x15, 0x10, 0x11, 0x16, 0x01, 0x10, 0x09,
+    0xFB, 0x00, 0x01, 0xEF, 0x10, 0xF1, 0xF0, 0xF5, 0x05, 0x00, 0x09, 0xFB, 0xF1, 0xDF, 0x00, 0xF1,
+    0xF1, 0x11, 0x0F, 0x01, 0x11, 0x00, 0x00, 0x11, 0x10, 0x10, 0x05, 0x05, 0x00, 0x01, 0x11, 0xF8,
+    0x01, 0xEA, 0xF1, 0xF0, 0x11, 0x10, 0x01, 0xF4, 0x01, 0x0C, 0x01, 0x05, 0x01, 0xFB, 0xF0, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x11, 0xEF, 0x15, 0x11, 0x08, 0xF0, 0x00, 0x00, 0x01,
+    0xEF, 0x00, 0x11, 0x11, 0x05, 0x15, 0x19, 0x1C, 0x10, 0x01, 0x11, 0x11, 0xEF, 0x00, 0x05, 0xF5,
+    0x11, 0x10, 0x09, 0x0C, 0x11, 0x11, 0x00, 0x11, 0x11, 0x05, 0x06, 0x19, 0x0A, 0xF5, 0xF6, 0x21,
+    0x21, 0xE9, 0xDF, 0x01, 0xFA, 0xF1, 0xEF, 0x11, 0x11, 0x05, 0x06, 0x08, 0xF1, 0xE9, 0xF1, 0xEF,
+    0x11, 0x11, 0x05, 0x05, 0x11, 0xEF, 0xF9, 0x23, 0x01, 0xFA, 0x10, 0x01, 0x21, 0x14, 0x01, 0xF5,
+    0x00, 0xF1, 0xF0, 0x09, 0xFA, 0x00, 0x11, 0x10, 0x00, 0x04, 0x11, 0x17, 0xF9, 0xE9, 0x00, 0xF1,
+    0xF0, 0x00, 0x05, 0x06, 0xF9, 0xEE, 0x01, 0xFB, 0x01, 0xDE, 0x01, 0x11, 0xE1, 0xDE, 0x11, 0x33,
+    0x01, 0xEF, 0xF1, 0x11, 0x10, 0xF9, 0xD9, 0x11, 0xF0, 0xF5, 0x04, 0x11, 0x11, 0x01, 0x11, 0xF1,
+    0xEF, 0xF1, 0xEF, 0x11, 0x11, 0x00, 0x00, 0x05, 0x05, 0x10, 0x0D, 0xFE, 0xFF, 0x0C, 0x11, 0x0C,
+    0x01, 0x12, 0x05, 0x04, 0x00, 0x01, 0xEF, 0xF1, 0xEF, 0x11, 0x11, 0x00, 0x19, 0x0D, 0x05, 0x04,
+    0x00, 0x01, 0x10, 0x11, 0x22, 0x10, 0x01, 0x11, 0x01, 0xEF, 0x05, 0x06, 0x19, 0xEF, 0x01, 0xFA,
+    0x11, 0x11, 0x11, 0x11, 0xF1, 0xEF, 0xF0, 0x00, 0x00, 0x05, 0x06, 0x00, 0xF9, 0xE9, 0x00, 0xF1,
+    0xEF, 0x01, 0x11, 0x00, 0x00, 0x10, 0x00, 0x10, 0x05, 0x06, 0x00, 0xF0, 0xF9, 0xE9, 0xF0, 0x00,
+    0x04, 0x18, 0xF0, 0x20, 0xF1, 0xF0, 0x11, 0x10, 0x00, 0x05, 0x17, 0xF1, 0xEF, 0xF8, 0x11, 0xFA,
+    0x11, 0x11, 0xF1, 0xEF, 0x05, 0x06, 0x00, 0x00, 0x00, 0x09, 0xFA, 0x00, 0x00, 0xF1, 0xF0, 0x00,
+    0x05, 0x06, 0x00, 0x19, 0x0A, 0x00, 0x05, 0x22, 0x11, 0xF5, 0xF0, 0x00, 0x19, 0xEF, 0x01, 0xFA,
+    0x00, 0x15, 0x17, 0x08, 0x01, 0x0B, 0x00, 0xF0, 0x00, 0x00, 0x05, 0xEF, 0x01, 0x17, 0x10, 0xF1,
+    0xEF, 0x09, 0xFA, 0x00, 0x00, 0x11, 0x06, 0x0D, 0xFC, 0xFF, 0xE4, 0xFD, 0xF1, 0xFF, 0xDA, 0x2D,
+    0xFD, 0xFF, 0xF2, 0x1D, 0xFC, 0xFF, 0x06, 0x11, 0x05, 0xF1, 0xF2, 0x11, 0x0E, 0xF1, 0xF2, 0x09,
+    0xFB, 0x00, 0xF4, 0xF1, 0x05, 0x11, 0x0E, 0x10, 0x19, 0xED, 0x01, 0x0E, 0x00, 0x01, 0x1E, 0x10,
+    0x11, 0x10, 0x05, 0xF0, 0x01, 0x06, 0xF9, 0xEB, 0x01, 0x0F, 0x01, 0x10, 0x25, 0xF6, 0xF8, 0x11,
+    0xFA, 0xF0, 0x10, 0xF0, 0x11, 0x10, 0x01, 0xF0, 0xF0, 0xF1, 0x10, 0x11, 0xE1, 0xF9, 0xFC, 0x25,
+    0x04, 0xF0, 0x05, 0x15, 0xF1, 0xF0, 0x09, 0xFB, 0x01, 0xF1, 0x00, 0x00, 0xF5, 0x05, 0x00, 0x09,
+    0xFB, 0x01, 0xF2, 0x00, 0xF1, 0xF1, 0xF0, 0xF1, 0xF1, 0xF0, 0x01, 0xF2, 0xF0, 0x10, 0x05, 0x05,
+    0x00, 0x19, 0x09, 0x00, 0xF1, 0xF2, 0x10, 0x00, 0x04, 0x01, 0x05, 0x00, 0xF9, 0xFB, 0x00, 0xFD,
+    0x02, 0x00, 0x08, 0xFD, 0x06, 0x00, 0x0E, 0x1D, 0x02, 0x00, 0x16, 0x00, 0x01, 0xF1, 0x00, 0x14,
+    0x0D, 0x04, 0x00, 0x16, 0x0D, 0x08, 0x00, 0x0C, 0x0D, 0x03, 0x00, 0x3A, 0x0D, 0x03, 0x00, 0x1C,
+    0x21, 0x17, 0x11, 0x11, 0xF1, 0xEF, 0x11, 0x11, 0x00, 0x11, 0x22, 0x01, 0xEF, 0x09, 0x11, 0x01,
+    0xE9, 0x01, 0x11, 0x05, 0xF5, 0x00, 0x00, 0x01, 0x11, 0x11, 0xEF, 0xF8, 0x11, 0xFA, 0x04, 0xF1,
+    0x06, 0xF1, 0xEF, 0x11, 0x11, 0x09, 0xFA, 0x10, 0xF5, 0xE4, 0x09, 0x1C, 0xF5, 0x06, 0x29, 0x11,
+    0x11, 0x0C, 0x01, 0xEE, 0xF1, 0xEF, 0xF5, 0x17, 0x01, 0xEF, 0xF0, 0x19, 0xFA, 0x00, 0xF1, 0xEF,
+    0x04, 0x01, 0x17, 0x00, 0x01, 0xEF, 0xE9, 0xD8, 0x00, 0xF1, 0xEF, 0x00, 0x05, 0x05, 0x00, 0xF1,
+    0xF0, 0x00, 0xF1, 0x0B, 0x01, 0xF5, 0x00, 0x11, 0x22, 0x31, 0xEE, 0xF0, 0x08, 0xF1, 0xEA, 0x00,
+    0xF5, 0x06, 0x21, 0x33, 0x00, 0x09, 0x0B, 0x11, 0xEF, 0x11, 0x11, 0x05, 0x06, 0x01, 0x11, 0x00,
+    0x09, 0xFA, 0x11, 0x11, 0x10, 0x00, 0x05, 0x18, 0xF1, 0xEE, 0x01, 0x24, 0x29, 0xEE, 0x01, 0xFA,
+    0x15, 0x12, 0x01, 0x06, 0x11, 0x12, 0x01, 0x12, 0x11, 0xEE, 0xE1, 0xEE, 0x09, 0x24, 0x15, 0x25,
+    0x30, 0x11, 0x25, 0xF1, 0xDB, 0xF0, 0x19, 0xF9, 0x05, 0xEE, 0xE1, 0xE2, 0xF0, 0xE1, 0xCA, 0xE9,
+    0xEF, 0xD1, 0xC7, 0x00, 0x05, 0x06, 0x09, 0x11, 0x01, 0xFA, 0x05, 0x11, 0x21, 0x06, 0x11, 0x11,
+    0x01, 0xEF, 0xF1, 0xDE, 0x11, 0x11, 0xE0, 0x11, 0x11, 0xF9, 0xE9, 0x11, 0x11, 0x05, 0xE4, 0x05,
+    0x11, 0xF9, 0xEF, 0x01, 0x33, 0x19, 0xE9, 0x01, 0x11, 0x10, 0x05, 0x06, 0x00, 0x00, 0x00, 0xF8,
+    0x11, 0xFA, 0x04, 0x01, 0x06, 0x11, 0x11, 0x01, 0x12, 0x19, 0x0C, 0x11, 0xEE, 0x00, 0xF4, 0xF1,
+    0xF4, 0x00, 0x01, 0x12, 0x21, 0xEE, 0xE0, 0x01, 0x12, 0x01, 0x12, 0x11, 0xDC, 0xF0, 0x11, 0x12,
+    0xF9, 0x0C, 0x01, 0xEE, 0x05, 0x06, 0x11, 0xEE, 0xE1, 0xEF, 0x11, 0x11, 0xF1, 0xEF, 0x19, 0x0B,
+    0xF4, 0x11, 0x06, 0x01, 0xEF, 0x01, 0x11, 0xE9, 0xDE, 0x11, 0x0B, 0x00, 0x05, 0xF5, 0xF1, 0xDE,
+    0x01, 0x22, 0x00, 0x11, 0x22, 0x01, 0xDE, 0xD1, 0xD8, 0x01, 0x06, 0x11, 0x11, 0x11, 0x11, 0x01,
+    0x22, 0x10, 0x09, 0xFA, 0x15, 0xF5, 0xF0, 0x00, 0xF1, 0xEF, 0x19, 0x0B, 0xF1, 0xEF, 0x01, 0xEF,
+    0xF5, 0xF5, 0x11, 0x11, 0x11, 0x11, 0xF0, 0x11, 0x11, 0x00, 0x01, 0xEF, 0x01, 0x11, 0x01, 0xEF,
+    0x01, 0x11, 0xF9, 0xE9, 0xF1, 0x11, 0x10, 0x21, 0x11, 0xF5, 0xF5, 0x01, 0x11, 0x01, 0xEF, 0xF8,
+    0xF1, 0xD8, 0xE1, 0x11, 0x35, 0x17, 0x10, 0x11, 0x11, 0x00, 0xF9, 0xFA, 0x00, 0x21, 0xEF, 0xE5,
+    0x17, 0x10, 0x00, 0x09, 0xEF, 0xF1, 0xFA, 0x01, 0xEF, 0x05, 0x06, 0x00, 0xF1, 0xEF, 0x11, 0x11,
+    0x01, 0x11, 0x09, 0xFA, 0x00, 0x04, 0x01, 0x06, 0x11, 0x11, 0xF1, 0xEF, 0x09, 0x0B, 0x10, 0x15,
+    0x12, 0xF1, 0xF4, 0xF0, 0x01, 0xEF, 0xF8, 0xF1, 0xE9, 0xF0, 0x25, 0xF5, 0xE1, 0xEF, 0x21, 0x22,
+    0x09, 0x0B, 0x10, 0x11, 0x11, 0x05, 0xEF, 0x01, 0x06, 0x01, 0x11, 0xF1, 0xEF, 0x01, 0xEF, 0xF0,
+    0x09, 0xD8, 0xF0, 0x11, 0x11, 0xE5, 0xF5, 0x11, 0x22, 0x29, 0x11, 0x11, 0xFA, 0xF5, 0x06, 0x00,
+    0x00, 0x01, 0x11, 0x08, 0x11, 0xFA, 0x11, 0x12, 0x00, 0xF5, 0x06, 0x01, 0x12, 0x01, 0x24, 0x82,
+    0x0A, 0x84, 0x00, 0x21, 0x27, 0x41, 0x26, 0x11, 0x13, 0xF1, 0x27, 0x10, 0x10, 0x00, 0x01, 0xED,
+    0xE1, 0xEC, 0x01, 0xED, 0xF0, 0xF1, 0xEC, 0x00, 0x00, 0x01, 0x14, 0x11, 0xEC, 0x00, 0xF1, 0x14,
+    0x10, 0xF0, 0x00, 0x25, 0x07, 0xF0, 0x00, 0x18, 0xF1, 0xF9, 0x01, 0xEC, 0xF0, 0x00, 0x00, 0x01,
+    0xEE, 0xF0, 0x09, 0xE4, 0x01, 0x14, 0x05, 0x12, 0x01, 0x08, 0x10, 0xF1, 0xEE, 0xF0, 0x11, 0xEC,
+    0x09, 0x0C, 0x05, 0x08, 0x01, 0xEC, 0xF0, 0x15, 0x1A, 0xED, 0xFE, 0xFF, 0xE6, 0x01, 0xF8, 0x10,
+    0x15, 0x1C, 0x01, 0xEC, 0xF0, 0x10, 0x09, 0x0C, 0x04, 0x01, 0x1A, 0x01, 0xEE, 0x11, 0x12, 0x00,
+    0x00, 0x10, 0x00, 0xF1, 0xEE, 0xF1, 0x12, 0x10, 0x00, 0x00, 0x11, 0x14, 0xF1, 0xEC, 0x10, 0xF0,
+    0x00, 0xD1, 0xB3, 0xD1, 0xDA, 0xE1, 0xC8, 0xD1, 0xDC, 0xF1, 0xEE, 0xE0, 0x01, 0xDC, 0xF8, 0x11,
+    0xE9, 0xF0, 0x05, 0x06, 0x00, 0x00, 0xF1, 0xEF, 0x01, 0xEF, 0x09, 0xEF, 0x04, 0xF0, 0x01, 0x11,
+    0xF1, 0xEF, 0x11, 0x11, 0x00, 0x01, 0xEF, 0x01, 0x22, 0x11, 0x22, 0x31, 0x5A, 0x8A, 0x0C, 0x99,
+    0x00, 0x21, 0x31, 0x31, 0x3B, 0x20, 0xF5, 0x09, 0x00, 0x00, 0xF1, 0xEB, 0x10, 0xE0, 0xF5, 0xE0,
+    0x00, 0xF0, 0x10, 0x01, 0xED, 0xF9, 0x13, 0x11, 0xE6, 0xE0, 0x01, 0xEC, 0x21, 0x27, 0x31, 0x3C,
+    0x00, 0x21, 0x28, 0xF1, 0xEB, 0xF1, 0xED, 0x00, 0x00, 0x00, 0x08, 0x04, 0x21, 0x3B, 0x01, 0xD8,
+    0x15, 0x1C, 0xF1, 0x15, 0x1D, 0xFE, 0xFF, 0xF7, 0xF4, 0x19, 0xF7, 0x05, 0x09, 0x00, 0x00, 0x01,
+    0x15, 0xF1, 0xD8, 0x09, 0xF7, 0xF5, 0xE1, 0xF1, 0x28, 0x11, 0x13, 0x28, 0x01, 0x0C, 0x11, 0xEB,
+    0xF4, 0x11, 0x1E, 0x05, 0x14, 0x01, 0xE0, 0x09, 0xF7, 0xE9, 0xF7, 0x01, 0xF6, 0x01, 0xF7, 0x0D,
+    0x02, 0x00, 0xE1, 0x01, 0x2F, 0x08, 0x11, 0x21, 0x01, 0xD8, 0x00, 0xF0, 0xF1, 0xD8, 0xF1, 0x28,
+    0x09, 0xD8, 0x01, 0xF7, 0x11, 0x13, 0xF5, 0xF6, 0x00, 0x00, 0x05, 0x07, 0x09, 0xF9, 0x00, 0x09,
+    0xF7, 0x05, 0x09, 0x00, 0x01, 0x13, 0x21, 0x15, 0x00, 0x00, 0x01, 0x13, 0x01, 0xED, 0x01, 0xD8,
+    0xE1, 0x13, 0x01, 0xED, 0x21, 0x3B, 0x21, 0x15, 0x00, 0xF1, 0xEB, 0x00, 0x01, 0xED, 0xF0, 0x00,
+    0x11, 0x13, 0x01, 0xED, 0x01, 0x13, 0xF1, 0xED, 0x00, 0x00, 0x01, 0xD8, 0x01, 0x28, 0xF1, 0xEB,
+    0x21, 0x28, 0x01, 0xED, 0xD9, 0xCF, 0xF5, 0xE1, 0xD1, 0xD9, 0xD1, 0x9F, 0xC1, 0xDA, 0xD1, 0xC8,
+    0xD1, 0xCA, 0xE1, 0xDC, 0xF9, 0xE9, 0xF5, 0xE4, 0xE1, 0xEF, 0x01, 0xDE, 0xE1, 0xE4, 0xF1, 0xE9,
+    0xE1, 0xDD, 0xE0, 0xF1, 0xF0, 0xF1, 0xEF, 0xFD, 0x26, 0x00, 0x27, 0xFE, 0x19, 0x00, 0xE8, 0x00,
+    0xED, 0x15, 0x00, 0x19, 0xDD, 0x04, 0x00, 0x4E, 0xFD, 0x02, 0x00, 0xEC, 0xF5, 0xD8, 0x05, 0x22,
+    0x11, 0x1A, 0xE9, 0xDF, 0xF5, 0xCB, 0x19, 0x1A, 0x05, 0xEC, 0xE1, 0xE5, 0x1D, 0x0C, 0x00, 0xF3,
+    0xFE, 0x0A, 0x00, 0xC6, 0x00, 0xDD, 0x09, 0x00, 0x15, 0x0D, 0x02, 0x00, 0x54, 0x05, 0x9C, 0x35,
+    0x7A, 0x00, 0x01, 0xDF, 0x21, 0xF5, 0xF1, 0x4E, 0xE1, 0x23, 0x11, 0xBB, 0x10, 0xF0, 0xF1, 0xDF,
+    0x10, 0x21, 0x66, 0x11, 0x23, 0xE1, 0x23, 0x11, 0xBA, 0x00, 0x09, 0x46, 0x11, 0xD1, 0x31, 0x23,
+    0x21, 0x47, 0xF5, 0x0D, 0x01, 0x24, 0x01, 0xDC, 0x01, 0xDC, 0x01, 0x48, 0x00, 0xD0, 0x10, 0x11,
+    0xDC, 0x19, 0x3C, 0xF5, 0xDB, 0x01, 0x33, 0x01, 0xA9, 0x21, 0x31, 0x11, 0x26, 0xE1, 0xB6, 0xE1,
+    0xDC, 0x29, 0x17, 0x31, 0x49, 0x05, 0x31, 0x01, 0x25, 0xFD, 0x06, 0x00, 0xDB, 0x1D, 0x07, 0x00,
+    0x68, 0xDD, 0x05, 0x00, 0xAE, 0x02, 0x96, 0x00, 0xE5, 0xBB, 0xD5, 0x37, 0x52, 0xE3, 0xFE, 0xC2,
+    0xA0, 0x00, 0x92, 0x60, 0xFF, 0xD2, 0x19, 0xFF, 0x22, 0x8E, 0x00, 0x21, 0x0A, 0x12, 0x43, 0xFF,
+    0xF2, 0xBD, 0x00, 0xA1, 0x29, 0x02, 0xF6, 0xFE, 0x72, 0xBB, 0x00, 0x26, 0x9D, 0x00, 0xE2, 0x6E,
+    0xFF, 0x11, 0x76, 0xC9, 0x1C, 0xE2, 0xF1, 0xFE, 0x71, 0x25, 0xF2, 0xC2, 0x00, 0x91, 0x8B, 0x40,
+    0x22, 0x9D, 0x00, 0xE2, 0x63, 0xFF, 0x61, 0xD9, 0xE2, 0xC4, 0x00, 0x81, 0xF8, 0xB2, 0x12, 0x3F,
+    0xFF, 0x71, 0x72, 0xD2, 0x9D, 0x00, 0x21, 0xD8, 0x32, 0x64, 0xFF, 0xE2, 0xC4, 0x00, 0xB1, 0x50,
+    0x02, 0xEC, 0xFE, 0x8E, 0x08, 0x05, 0x00, 0xFF, 0x00, 0xFD, 0x11, 0x00, 0x4D, 0xEE, 0x03, 0x00,
+    0xBB, 0x00, 0x4D, 0x03, 0x00, 0xF0, 0xD1, 0x70, 0x95, 0x73, 0x02, 0x4F, 0xFE, 0x55, 0xE0, 0xDA,
+    0xAE, 0x00, 0x21, 0x31, 0x20, 0x52, 0x56, 0x01, 0xA1, 0x9C, 0xA6, 0x22, 0xFE, 0x71, 0x3B, 0xF2,
+    0xF0, 0x00, 0xC9, 0x90, 0x31, 0x31, 0x36, 0x8F, 0x00, 0xA1, 0x42, 0xFA, 0x70, 0xFE, 0x65, 0xE0,
+    0x2E, 0xFE, 0xFF, 0x9F, 0x01, 0xB1, 0x8F, 0x11, 0xA1, 0x56, 0x02, 0x01, 0xA5, 0xCE, 0xE2, 0xBE,
+    0xFE, 0x81, 0x09, 0x30, 0x0A, 0x75, 0x01, 0x82, 0xF8, 0x3B, 0xFF, 0x31, 0xA2, 0x05, 0x3F, 0xD2,
+    0xC4, 0x00, 0xEA, 0x4C, 0xFE, 0x71, 0x97, 0x02, 0xA9, 0x01, 0xA1, 0x9F, 0x06, 0x42, 0xFF, 0x42,
+    0xCF, 0x00, 0xE1, 0x9F, 0x29, 0xA0, 0x41, 0x21, 0x02, 0x53, 0x01, 0x82, 0xF7, 0x6C, 0xFF, 0x26,
+    0x41, 0xFF, 0x21, 0x0F, 0xD9, 0xD0, 0x41, 0xC3, 0x02, 0xED, 0x00, 0x92, 0x92, 0x00, 0x22, 0x81,
+    0xFE, 0x60, 0x02, 0x1D, 0x01, 0xF5, 0x80, 0xF9, 0x92, 0x42, 0x50, 0x01, 0x81, 0xF8, 0x9E, 0xD2,
+    0x5B, 0xFE, 0x82, 0x09, 0x88, 0x00, 0xC1, 0x5E, 0xC1, 0xA2, 0x52, 0x8E, 0x00, 0xB1, 0xD0, 0x46,
+    0x54, 0xFF, 0x52, 0x7C, 0x01, 0x82, 0xF6, 0x3F, 0xFF, 0x22, 0x73, 0xFF, 0x8A, 0x08, 0xAE, 0x00,
+    0xC1, 0xA1, 0xD1, 0xD1, 0x55, 0x85, 0xD2, 0xE8, 0x00, 0x92, 0xBF, 0xFE, 0x8A, 0x0A, 0xB4, 0x00,
+    0xF2, 0xDF, 0x00, 0xB1, 0x91, 0x31, 0x0E, 0xE0, 0xC6, 0xFA, 0xFE, 0x81, 0x08, 0x5A, 0x12, 0x4C,
+    0x01, 0x8A, 0xF6, 0x2E, 0xFE, 0x71, 0x79, 0x06, 0xC8, 0x00, 0xE2, 0xEB, 0xFE, 0x02, 0xA8, 0x00,
+    0xC2, 0x58, 0xFF, 0x68, 0x32, 0x95, 0x01, 0x82, 0xF7, 0x71, 0xFF, 0x02, 0xEE, 0xFE, 0x72, 0xE3,
+    0x00, 0xF1, 0x2F, 0x11, 0xA2, 0x32, 0x1D, 0x01, 0x90, 0xF6, 0x95, 0xFE, 0x81, 0x0A, 0x5C, 0xB2,
+    0x8F, 0x00, 0xB2, 0x43, 0xFF, 0x29, 0x20, 0xC1, 0x2F, 0x12, 0x49, 0xFF, 0x81, 0x09, 0x2D, 0xF6,
+    0x59, 0x01, 0x80, 0xF8, 0x32, 0x10, 0xFF, 0x21, 0x5F, 0xE1, 0xA1, 0x51, 0xA4, 0x1A, 0x7C, 0x01,
+    0x91, 0x51, 0x12, 0x81, 0xFE, 0x89, 0x08, 0x21, 0xD6, 0xBD, 0x00, 0xD1, 0xB0, 0x46, 0x8F, 0x00,
+    0x21, 0x73, 0x81, 0xF8, 0xCF, 0xE2, 0x53, 0xFE, 0x89, 0x09, 0x4E, 0xD2, 0xBF, 0x00, 0xC1, 0x9F,
+    0x24, 0xD1, 0x70, 0x02, 0x12, 0xFF, 0x89, 0x09, 0x4F, 0xF2, 0x1F, 0x01, 0x91, 0x31, 0x32, 0x0F,
+    0xFF, 0x05, 0xDF, 0xE1, 0xD0, 0x59, 0x96, 0xF2, 0x1A, 0x01, 0x86, 0xF8, 0xA3, 0x00, 0x42, 0xAD,
+    0xFE, 0x21, 0xD1, 0x22, 0xC0, 0x00, 0xE1, 0xCF, 0x39, 0xF1, 0x52, 0x9A, 0x01, 0x81, 0xF8, 0x89,
+    0xF6, 0x97, 0x00, 0x22, 0x86, 0xFE, 0x31, 0xC0, 0xD1, 0x40, 0x29, 0x90, 0x02, 0xBF, 0x00, 0xA2,
+    0x94, 0x00, 0x06, 0x5D, 0xFE, 0x60, 0x01, 0x5F, 0xF2, 0x91, 0x00, 0x11, 0xD0, 0x32, 0xF4, 0x00,
+    0x82, 0xF8, 0x6C, 0xFF, 0xD2, 0x84, 0xFE, 0x81, 0x09, 0x2E, 0xC2, 0xBD, 0x00, 0xC9, 0x92, 0x20,
+    0xD1, 0x2F, 0x02, 0x47, 0xFF, 0x81, 0x09, 0x5B, 0xE2, 0xED, 0x00, 0x85, 0xF8, 0x41, 0x52, 0x3F,
+    0xFF, 0x01, 0xA1, 0x22, 0xC0, 0x00, 0x41, 0xCF, 0xF2, 0xC2, 0x00, 0x80, 0xF8, 0x02, 0x81, 0xFE,
+    0x58, 0x12, 0x0D, 0x01, 0xE5, 0xA1, 0x01, 0x0F, 0xC2, 0x91, 0x00, 0x02, 0xB2, 0xFE, 0x59, 0x98,
+    0x22, 0xA5, 0x01, 0x92, 0xE3, 0xFE, 0xF1, 0xA5, 0x22, 0x8A, 0x00, 0xC6, 0x1D, 0xFF, 0x39, 0x2C,
+    0x22, 0xB7, 0x00, 0xE1, 0xA4, 0x35, 0x2D, 0x01, 0x6D, 0xD9, 0xA1, 0xE2, 0x6A, 0xFF, 0x29, 0xD4,
+    0x0D, 0xFC, 0xFF, 0x43, 0xFD, 0xF8, 0xFF, 0x93, 0x2D, 0xFE, 0xFF, 0x20, 0x0D, 0xFE, 0xFF, 0x49,
+    0x01, 0xA3, 0x31, 0x53, 0x21, 0x7F, 0xD9, 0xF4, 0x21, 0xD7, 0x11, 0x29, 0x05, 0x0C, 0x10, 0x01,
+    0x2A, 0xE9, 0xF5, 0xF1, 0xD5, 0x05, 0xB7, 0x01, 0xD6, 0xF0, 0x01, 0xD6, 0x01, 0x2A, 0xE9, 0x1F,
+    0x11, 0xAC, 0x3D, 0x02, 0x00, 0x0B, 0xE9, 0x2A, 0xF0, 0x10, 0xE0, 0x09, 0xA2, 0x25, 0x0B, 0x01,
+    0x53, 0xD1, 0xD6, 0x15, 0xE1, 0x0D, 0xFE, 0xFF, 0xF6, 0x01, 0xF5, 0x21, 0x53, 0xE0, 0x05, 0xB8,
+    0x31, 0x29, 0x11, 0x7F, 0xF0, 0x19, 0xF5, 0x15, 0x35, 0xE1, 0x2A, 0xF2, 0x57, 0xFF, 0x30, 0x09,
+    0x73, 0xE0, 0x01, 0xAC, 0x00, 0xF5, 0xD6, 0x21, 0x0B, 0xF9, 0x2A, 0x11, 0x20, 0xE0, 0x01, 0xAB,
+    0x05, 0x0B, 0xF1, 0xD6, 0x00, 0xE1, 0x2A, 0x19, 0xAD, 0x31, 0xF5, 0xF5, 0x5E, 0xE1, 0xD6, 0x01,
+    0xD7, 0x09, 0x7D, 0x11, 0xA1, 0x11, 0xAF, 0x22, 0xA5, 0x00, 0xF0, 0xD1, 0x83, 0x10, 0x01, 0x29,
+    0x11, 0xAF, 0xE1, 0x28, 0xE4, 0x11, 0xE2, 0x21, 0x29, 0x21, 0x7D, 0x00, 0x19, 0x2B, 0x21, 0x49,
+    0xE4, 0x01, 0xB7, 0x35, 0x2A, 0xF1, 0x36, 0xF9, 0xCA, 0xFA, 0x76, 0xFF, 0x05, 0x60, 0xD0, 0xF2,
+    0x58, 0xFF, 0x31, 0x53, 0x21, 0x7F, 0xE0, 0x39, 0x2A, 0xF1, 0xF5, 0xF5, 0xB7, 0x00, 0x21, 0xD5,
+    0xF1, 0x55, 0xF0, 0x01, 0xD6, 0x01, 0x2A, 0xF1, 0xAB, 0x29, 0xCB, 0x15, 0x55, 0x09, 0x54, 0xF1,
+    0xD5, 0x05, 0x0C, 0x01, 0x2A, 0xF1, 0xAC, 0x21, 0x2A, 0x11, 0xAB, 0x12, 0xD5, 0x00, 0xF1, 0xD5,
+    0xF1, 0xD5, 0x21, 0x56, 0xD1, 0xAA, 0xE9, 0x81, 0x31, 0xF5, 0x12, 0xA9, 0x00, 0xE0, 0x15, 0xE1,
+    0x11, 0x2B, 0xFA, 0x0C, 0x01, 0xE2, 0x6A, 0xFE, 0x11, 0x29, 0x02, 0x05, 0x01, 0x86, 0x09, 0xE4,
+    0x00, 0x82, 0xF4, 0xA4, 0xFD, 0xE1, 0x84, 0x91, 0x29, 0x70, 0x31, 0x7D, 0xF1, 0xD6, 0x41, 0x55,
+    0x41, 0xD5, 0x12, 0x5B, 0x01, 0x81, 0xF8, 0xD3, 0x1A, 0xF2, 0xFE, 0x21, 0x54, 0x05, 0x0B, 0xC2,
+    0x57, 0xFF, 0x60, 0x02, 0xFF, 0x00, 0xE1, 0xAA, 0xC1, 0xD6, 0x22, 0x2E, 0xFF, 0xE1, 0x7D, 0x0D,
+    0x08, 0x00, 0xEC, 0x3D, 0x04, 0x00, 0x24, 0x2E, 0x04, 0x00, 0x72, 0x01, 0x85, 0xF8, 0xF0, 0x02,
+    0xB6, 0xFE, 0x82, 0x08, 0xBB, 0x00, 0x16, 0xF1, 0x00, 0xEA, 0x0F, 0xFF, 0x12, 0xC0, 0x00, 0xA1,
+    0x31, 0xF2, 0x81, 0xFE, 0x21, 0x5E, 0x71, 0x30, 0xF2, 0xF1, 0x00, 0xE1, 0x9E, 0x21, 0xD0, 0x3A,
+    0x16, 0x01, 0xA5, 0x33, 0xE2, 0x58, 0xFE, 0x65, 0x5F, 0x01, 0x11, 0xD9, 0x30, 0x21, 0xEF, 0x22,
+    0xC5, 0x00, 0x21, 0x66, 0x82, 0xF6, 0x69, 0xFF, 0x02, 0xAD, 0xFE, 0x72, 0x8F, 0x00, 0xE1, 0x61,
+    0xE2, 0x71, 0xFF, 0x3A, 0xAF, 0x00, 0xB0, 0xE6, 0xC1, 0xFE, 0x81, 0x08, 0x5F, 0x21, 0x5F, 0xF2,
+    0xF5, 0x00, 0xE1, 0x9D, 0x22, 0x6E, 0xFF, 0x02, 0xF5, 0x00, 0x25, 0x66, 0x81, 0xF7, 0xE0, 0x32,
+    0x06, 0xFF, 0x59, 0x20, 0xA1, 0x9F, 0xD2, 0x71, 0xFF, 0x51, 0xD1, 0x26, 0x93, 0x01, 0xA1, 0x33,
+    0xF2, 0x78, 0xFE, 0x59, 0x21, 0xC9, 0xF1, 0x01, 0xD1, 0x45, 0x0E, 0x16, 0x32, 0x01, 0x80, 0xF8,
+    0xF2, 0x50, 0xFE, 0x4D, 0x03, 0x00, 0xDF, 0x0E, 0x02, 0x00, 0x28, 0x01, 0x00, 0x25, 0x75, 0xC2,
+    0xCC, 0x00, 0x02, 0x6A, 0xFE, 0x71, 0xCF, 0xF1, 0x63, 0xE2, 0x98, 0x00, 0xD1, 0x9B, 0x52, 0xCA,
+    0x00, 0xA4, 0xF2, 0xAE, 0xFE, 0x80, 0x08, 0x0A, 0x85, 0x01, 0x91, 0x9A, 0x21, 0xCE, 0x41, 0x65,
+    0xC1, 0x33, 0xF2, 0xD0, 0xFE, 0x80, 0x08, 0xF2, 0x64, 0x01, 0x95, 0xA9, 0x11, 0xCD, 0x59, 0x56,
+    0xD1, 0x69, 0xE1, 0x35, 0x12, 0x98, 0xFE, 0x85, 0x08, 0xCD, 0xD2, 0x42, 0x01, 0xBA, 0x55, 0xFF,
+    0x01, 0x9C, 0xC1, 0x32, 0x12, 0x36, 0xFF, 0x70, 0x10, 0xE2, 0x2F, 0x01, 0xA2, 0x69, 0xFF, 0x11,
+    0x9A, 0x12, 0x98, 0x00, 0x92, 0x47, 0xFE, 0x61, 0xD2, 0x22, 0xB5, 0x01, 0x82, 0xF8, 0x79, 0xFE,
+    0x42, 0x8E, 0x00, 0x2A, 0x85, 0x00, 0xD5, 0xAB, 0x39, 0x63, 0xC4, 0xC6, 0x90, 0xFE, 0x89, 0x09,
+    0x4F, 0x1A, 0x87, 0x01, 0x82, 0xF7, 0xF9, 0xFE, 0x12, 0x74, 0xFF, 0x21, 0x5D, 0x15, 0xA3, 0x32,
+    0x2D, 0x01, 0x80, 0xF8, 0x02, 0x84, 0xFE, 0x82, 0x0B, 0xB8, 0x00, 0xE2, 0xF7, 0x00, 0xB1, 0x9B,
+    0x21, 0xCF, 0xD2, 0x71, 0xFF, 0x32, 0x76, 0xFF, 0x22, 0x7C, 0x01, 0x81, 0xF7, 0x23, 0x22, 0x8E,
+    0xFE, 0x81, 0x09, 0x5D, 0x92, 0x8F, 0x00, 0x02, 0x71, 0xFF, 0x32, 0x25, 0x01, 0xF2, 0x3A, 0xFF,
+    0x52, 0x44, 0xFF, 0xE2, 0x4F, 0x01, 0xA0, 0x06, 0xDF, 0xFE, 0x6A, 0x8E, 0x00, 0xC1, 0xCF, 0x11,
+    0x31, 0xB9, 0x22, 0xE6, 0x99, 0xFE, 0x82, 0x08, 0x75, 0x01, 0x81, 0xF7, 0x63, 0x42, 0xB1, 0xFE,
+    0x61, 0x2E, 0xD1, 0x5D, 0x21, 0xD2, 0x12, 0xC0, 0x00, 0x82, 0xF7, 0x5A, 0xFE, 0x81, 0x09, 0x2D,
+    0x22, 0xDE, 0x01, 0x81, 0xF7, 0x9B, 0x2A, 0x05, 0xFF, 0x15, 0x3B, 0x05, 0xD1, 0x3A, 0xBE, 0x00,
+    0xA1, 0x31, 0xF2, 0x87, 0xFE, 0x82, 0x0A, 0xAB, 0x01, 0x81, 0xF8, 0x33, 0x26, 0xDB, 0xFE, 0x39,
+    0x2E, 0xD1, 0xDE, 0x31, 0x97, 0x12, 0x1D, 0x01, 0x82, 0xF7, 0x5A, 0xFE, 0x62, 0x7C, 0xFF, 0x82,
+    0xF7, 0x3B, 0x01, 0x12, 0xF0, 0xFE, 0x42, 0x86, 0x00, 0xC1, 0x5C, 0x2E, 0xFE, 0xFF, 0x77, 0xFF,
+    0x1D, 0xF8, 0xFF, 0xBC, 0xCE, 0xF2, 0xFF, 0x2A, 0xFF, 0x1D, 0xFD, 0xFF, 0xE6, 0x3D, 0xFD, 0xFF,
+    0x39, 0x31, 0x41, 0x4A, 0xB3, 0x00, 0xE1, 0xB3, 0x2D, 0xFC, 0xFF, 0xDA, 0xED, 0xFB, 0xFF, 0xCE,
+    0xED, 0xFA, 0xFF, 0xE4, 0x2D, 0xFE, 0xFF, 0xD2, 0x1D, 0xFD, 0xFF, 0x0E, 0x19, 0x0E, 0x32, 0x8A,
+    0x00, 0x62, 0xAF, 0x00, 0xF1, 0x4A, 0x11, 0xDB, 0x09, 0xDB, 0x11, 0x18, 0x00, 0xF1, 0xDD, 0x10,
+    0x01, 0xDC, 0x01, 0x47, 0xF1, 0x25, 0x20, 0x11, 0x25, 0x11, 0x26, 0xE0, 0x11, 0x26, 0x11, 0xDA,
+    0x01, 0xDA, 0xF1, 0xDB, 0xE1, 0xDB, 0xF1, 0xDD, 0x01, 0xB8, 0x02, 0xA0, 0xFD, 0xF2, 0x84, 0x02,
+    0xE1, 0xB9, 0x00, 0xF0, 0x01, 0x47, 0x11, 0xB9, 0x25, 0x0B, 0xF9, 0x18, 0x11, 0x24, 0x11, 0x24,
+    0x11, 0x23, 0xF1, 0xDD, 0xE1, 0xDC, 0xF1, 0xB9, 0x01, 0xBC, 0xE0, 0x00, 0x21, 0x22, 0x01, 0x22,
+    0xE1, 0xDE, 0xE1, 0x99, 0x31, 0x22, 0xF1, 0x23, 0x00, 0x11, 0xBB, 0xF1, 0x45, 0xD1, 0xBB, 0xF1,
+    0xBD, 0x11, 0xDF, 0xF1, 0x21, 0xF1, 0xDF, 0xF0, 0x01, 0xE0, 0x31, 0x20, 0x19, 0x5A, 0xE1, 0x44,
+    0x65, 0x4F, 0x35, 0x76, 0x00, 0xF1, 0x25, 0x09, 0xB7, 0x21, 0xF5, 0x56, 0xDD, 0x00, 0x19, 0x4A,
+    0x00, 0x05, 0x0D, 0x19, 0xF3, 0x10, 0x00, 0x11, 0x71, 0x01, 0x0F, 0xF5, 0xDA, 0x09, 0xF1, 0x10,
+    0x01, 0xDA, 0x00, 0x01, 0x4C, 0xF1, 0xDA, 0x05, 0xDA, 0x09, 0xDB, 0xF1, 0xDB, 0x09, 0xF1, 0x01,
+    0x4A, 0xF5, 0xDB, 0x11, 0x34, 0x31, 0x4C, 0x01, 0xDA, 0x00, 0x01, 0x26, 0x01, 0x27, 0x01, 0x27,
+    0x00, 0xF0, 0x01, 0xB2, 0xF1, 0xDA, 0x10, 0xE0, 0xF1, 0x26, 0x10, 0x00, 0xF1, 0x8F, 0x11, 0x25,
+    0x00, 0xF1, 0xDB, 0x00, 0x21, 0xDB, 0xF1, 0x25, 0x11, 0x4B, 0x00, 0x00, 0x00, 0x20, 0x01, 0x26,
+    0x11, 0x27, 0xF0, 0x01, 0x27, 0x00, 0xF5, 0x10, 0x01, 0xB1, 0xF9, 0xCB, 0x00, 0x00, 0xF5, 0x4D,
+    0x21, 0x0F, 0x09, 0x28, 0x11, 0xF0, 0x01, 0xD9, 0x11, 0x27, 0x11, 0x27, 0xF1, 0xD9, 0x04, 0xF1,
+    0x10, 0x09, 0xC9, 0xF1, 0xB3, 0x00, 0x10, 0x00, 0xF0, 0xF0, 0xE1, 0x90, 0xF1, 0xB5, 0x01, 0xDA,
+    0xF1, 0x4C, 0xF1, 0xE7, 0xF1, 0x19, 0x30, 0x01, 0x25, 0x11, 0x25, 0xE0, 0x00, 0x01, 0xB6, 0xF1,
+    0xDA, 0xF0, 0xE1, 0xB5, 0xF1, 0xB8, 0xF1, 0xDC, 0xF2, 0x52, 0xFF, 0xA1, 0xC6, 0xD2, 0x54, 0xFF,
+    0xE0, 0xE1, 0xC2, 0x21, 0xE1, 0x42, 0xDE, 0x00, 0xC2, 0x7F, 0xFF, 0xB6, 0x8A, 0x00, 0x42, 0x5F,
+    0xFF, 0x81, 0x08, 0xE2, 0xC2, 0x9E, 0x00, 0xC1, 0x80, 0x31, 0x20, 0xE0, 0x31, 0xC2, 0x0A, 0x95,
+    0x00, 0x82, 0xF7, 0xEA, 0xFE, 0x81, 0x0A, 0x59, 0x02, 0xDE, 0x00, 0x92, 0x22, 0xFF, 0x51, 0x5D,
+    0xE0, 0x21, 0xC2, 0x32, 0xE0, 0x00, 0x86, 0xF7, 0xEB, 0xFE, 0x89, 0x08, 0xBD, 0x02, 0x37, 0x01,
+    0x82, 0xF8, 0x04, 0xFF, 0x41, 0x1E, 0x01, 0x5D, 0x21, 0x40, 0xB0, 0xE2, 0x27, 0xFF, 0x85, 0x0A,
+    0x44, 0xE2, 0xBE, 0x00, 0x92, 0x24, 0xFF, 0x81, 0x09, 0x5C, 0xB1, 0x20, 0x00, 0xF2, 0x81, 0x00,
+    0x12, 0x7F, 0xFF, 0x79, 0xF7, 0x12, 0x09, 0x01, 0x82, 0xF8, 0x78, 0xFF, 0xE2, 0x41, 0xFF, 0x72,
+    0x9E, 0x00, 0xE1, 0xA0, 0xF1, 0x40, 0xD2, 0x84, 0x00, 0xF2, 0xFE, 0xFE, 0x75, 0x47, 0x42, 0x2D,
+    0x01, 0x91, 0x98, 0x11, 0x9B, 0x21, 0x65, 0xCA, 0x52, 0xFF, 0x45, 0x61, 0x42, 0xB5, 0x00, 0x8A,
+    0xF6, 0xAB, 0xFE, 0x51, 0xC2, 0xE2, 0x9D, 0x00, 0xD1, 0xC0, 0x31, 0x40, 0xE1, 0xC0, 0x65, 0xA3,
+    0xE2, 0xE7, 0x00, 0x89, 0xF8, 0x18, 0x82, 0x09, 0x20, 0xFF, 0xE2, 0x9E, 0x00, 0xD1, 0xE0, 0x31,
+    0x20, 0xD1, 0x42, 0x42, 0x3F, 0xFF, 0x12, 0xC1, 0x00, 0x81, 0xF8, 0xDF, 0x12, 0x41, 0xFF, 0x51,
+    0x3E, 0xC0, 0x15, 0x09, 0x0A, 0x81, 0x00, 0xF2, 0x57, 0xFF, 0x82, 0x08, 0x05, 0x01, 0x81, 0xF7,
+    0x9B, 0xE6, 0x0C, 0xFF, 0x82, 0x08, 0x9B, 0x00, 0x22, 0xA6, 0x00, 0xDA, 0x13, 0xFF, 0xC1, 0x5F,
+    0xC2, 0x27, 0xFF, 0x81, 0x09, 0x3C, 0x22, 0x21, 0x01, 0x91, 0xDE, 0x52, 0x5E, 0xFF, 0xE1, 0x40,
+    0xE1, 0x82, 0xF9, 0x16, 0xC5, 0x8F, 0x56, 0xC1, 0x00, 0x41, 0x62, 0x09, 0x18, 0xE5, 0x9E, 0x4D,
+    0xFE, 0xFF, 0x58, 0xFD, 0xFB, 0xFF, 0x2F, 0x1D, 0xF6, 0xFF, 0x92, 0x8E, 0x09, 0xFC, 0xFF, 0x29,
+    0x01, 0x4D, 0xFD, 0xFF, 0x28, 0x29, 0x4A, 0x2A, 0x83, 0x00, 0x21, 0x14, 0x21, 0x63, 0x41, 0x22,
+    0x11, 0x21, 0x10, 0x00, 0x10, 0xD9, 0xAF, 0x25, 0x44, 0x05, 0x1C, 0x19, 0xF1, 0x01, 0xDF, 0x01,
+    0x21, 0xF1, 0xDF, 0x09, 0x14, 0x05, 0x0D, 0x00, 0xF1, 0x9C, 0x11, 0x43, 0x09, 0x14, 0x01, 0x22,
+    0x15, 0x0E, 0x01, 0x22, 0x00, 0x21, 0x23, 0xF9, 0xCF, 0xF5, 0xEC, 0xF0, 0xE1, 0xDD, 0x05, 0xDF,
+    0x01, 0x0D, 0x28, 0xF1, 0xD1, 0x11, 0x43, 0x11, 0x23, 0x11, 0x22, 0x01, 0x23, 0x11, 0xDD, 0xF0,
+    0x21, 0x23, 0xE1, 0xDD, 0x00, 0x00, 0x11, 0x23, 0x00, 0x11, 0xDD, 0xF9, 0xF2, 0xF0, 0xF0, 0x01,
+    0x45, 0x25, 0xEC, 0x00, 0xF1, 0xBB, 0x01, 0x45, 0x01, 0x23, 0x10, 0x10, 0x00, 0xE1, 0xBA, 0x01,
+    0x46, 0x00, 0x00, 0x01, 0xBA, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x20, 0x00, 0x00, 0x01, 0x46, 0x09,
+    0xDD, 0x04, 0x20, 0x01, 0x23, 0xE0, 0x00, 0x21, 0xDD, 0xF0, 0x10, 0x01, 0x23, 0xF1, 0x24, 0x11,
+    0x10, 0x11, 0xCC, 0xF0, 0x09, 0x15, 0xF5, 0x0F, 0x11, 0xDC, 0x01, 0xDD, 0xD2, 0x34, 0xFF, 0x9A,
+    0x1A, 0xFF, 0x92, 0x1C, 0xFF, 0x81, 0xF8, 0x89, 0xB6, 0x27, 0xFF, 0x99, 0x96, 0xC5, 0x9B, 0xD9,
+    0xB8, 0x82, 0x0B, 0x0F, 0x01, 0xA2, 0x65, 0xFF, 0x12, 0x9B, 0x00, 0x15, 0x97, 0x71, 0x21, 0x32,
+    0xF8, 0x00, 0x89, 0xF7, 0x8F, 0xF2, 0x58, 0xFF, 0x31, 0x34, 0xF5, 0xED, 0x01, 0x1A, 0xC1, 0x6D,
+    0x22, 0x5F, 0xFF, 0x89, 0x08, 0xDF, 0xE2, 0xBA, 0x00, 0xB0, 0x55, 0x94, 0xE1, 0x3D, 0x21, 0xCA,
+    0x01, 0x6D, 0x91, 0x39, 0x12, 0x26, 0xFF, 0x89, 0x08, 0x13, 0xD5, 0x72, 0xD1, 0xAF, 0x10, 0xB9,
+    0x99, 0x51, 0xC8, 0x92, 0xCD, 0x00, 0xE6, 0x08, 0xFF, 0x81, 0x0A, 0x4A, 0x02, 0xB6, 0x00, 0xC1,
+    0x96, 0x21, 0x34, 0xC1, 0x99, 0x60, 0x22, 0xD4, 0x00, 0x82, 0xF6, 0xFA, 0xFE, 0x71, 0x19, 0x12,
+    0xB6, 0x00, 0xD9, 0xC3, 0x15, 0x07, 0xD1, 0xB3, 0x41, 0xCD, 0x22, 0xD1, 0x00, 0x81, 0xF8, 0x1C,
+    0x82, 0x08, 0x2C, 0xFF, 0x02, 0xB8, 0x00, 0xD1, 0x1C, 0x40, 0xF1, 0x1C, 0xC2, 0x5D, 0xFF, 0x61,
+    0xE6, 0x0A, 0xB5, 0x00, 0x81, 0xF8, 0xAD, 0xF2, 0x65, 0xFF, 0x35, 0x53, 0xF1, 0xB3, 0x32, 0x82,
+    0x00, 0xC1, 0x52, 0x0A, 0x3E, 0xFF, 0x72, 0xBA, 0x00, 0x85, 0xF8, 0xE4, 0x12, 0x6A, 0xFF, 0x31,
+    0x19, 0xF1, 0x1A, 0x21, 0x1A, 0xB1, 0x36, 0x02, 0x5D, 0xFF, 0x81, 0x0A, 0x20, 0xD2, 0x9E, 0x00,
+    0x91, 0xE5, 0x51, 0xCA, 0x11, 0x36, 0x12, 0x7D, 0xFF, 0xF2, 0x83, 0x00, 0xA1, 0x53, 0x12, 0x2A,
+    0xFF, 0x79, 0xF8, 0xE2, 0x83, 0x00, 0xC5, 0x9E, 0x21, 0x34, 0xE1, 0xCC, 0x51, 0xCD, 0x02, 0xB8,
+    0x00, 0x98, 0x56, 0x5A, 0xFF, 0x32, 0xC2, 0x00, 0xB2, 0x79, 0xFF, 0x25, 0x50, 0x82, 0x09, 0xCE,
+    0x00, 0x5A, 0xAC, 0x00, 0x52, 0x9B, 0x00, 0x11, 0x60, 0x62, 0x84, 0x00, 0x25, 0x50, 0x31, 0x67,
+    0x01, 0x22, 0x21, 0x23, 0x19, 0xDD, 0x01, 0xF1, 0x01, 0xDE, 0xD0, 0x01, 0x22, 0x10, 0x10, 0x10,
+    0x00, 0xF1, 0x23, 0x10, 0x04, 0x09, 0xDD, 0x00, 0xE0, 0x11, 0x23, 0x21, 0x23, 0x05, 0x24, 0x01,
+    0xEB, 0x19, 0x15, 0x01, 0x23, 0x01, 0xDD, 0x10, 0xF0, 0xF0, 0x01, 0x23, 0x11, 0xDD, 0x01, 0xDC,
+    0xE0, 0x32, 0x8D, 0x00, 0x01, 0xDD, 0x01, 0xDD, 0xE1, 0xDD, 0x11, 0x69, 0x01, 0xDD, 0xF1, 0xDD,
+    0x01, 0xDD, 0x01, 0x46, 0x00, 0x00, 0x11, 0xDD, 0xF1, 0xDD, 0x05, 0x23, 0x01, 0x33, 0x01, 0xDD,
+    0x29, 0x13, 0x00, 0xF0, 0x05, 0x33, 0x11, 0xDD, 0x01, 0xDD, 0x09, 0x23, 0x01, 0xF0, 0x01, 0xDD,
+    0x01, 0xDD, 0x11, 0x46, 0xE1, 0xDD, 0x05, 0xDD, 0x01, 0x10, 0x11, 0xDB, 0xD9, 0xF1, 0x21, 0x47,
+    0x10, 0x00, 0xE1, 0xDD, 0x00, 0x11, 0x46, 0x10, 0x00, 0x01, 0x23, 0x00, 0xF1, 0xDD, 0x01, 0xDD,
+    0x01, 0xDD, 0x10, 0xE0, 0x01, 0x23, 0x11, 0xDD, 0xF5, 0xEB, 0xF9, 0xF1, 0x00, 0x11, 0x47, 0x01,
+    0xDD, 0x10, 0xF0, 0x01, 0x46, 0x10, 0x10, 0xF1, 0xDD, 0xF1, 0x23, 0x05, 0xED, 0x00, 0x09, 0xDD,
+    0x01, 0xF0, 0xF1, 0x23, 0x05, 0xED, 0x01, 0x23, 0x20, 0xF9, 0x36, 0x10, 0x11, 0x23, 0x20, 0xF5,
+    0xED, 0xF9, 0xF0, 0x10, 0x01, 0xBA, 0xF0, 0x01, 0x23, 0x00, 0x01, 0xBA, 0x00, 0x05, 0x10, 0xF9,
+    0xF0, 0x01, 0x23, 0x11, 0x23, 0x00, 0xF1, 0x96, 0xF0, 0xF0, 0xF1, 0xDD, 0x19, 0x14, 0xF5, 0xA7,
+    0x11, 0x45, 0x01, 0x23, 0xF0, 0x10, 0x01, 0xBA, 0x11, 0x46, 0x00, 0xE1, 0xBA, 0x11, 0x46, 0xF1,
+    0xBA, 0x00, 0x11, 0x46, 0x01, 0x24, 0x21, 0x23, 0x11, 0xB9, 0xE1, 0xBA, 0xF9, 0x46, 0xE1, 0x8A,
+    0xB6, 0xD6, 0xFE, 0x82, 0xF7, 0x11, 0xFF, 0x82, 0xF7, 0x69, 0xFF, 0xC2, 0x02, 0xFF, 0x81, 0xF7,
+    0x98, 0xB1, 0x83, 0xB9, 0x8D, 0xC1, 0xA5, 0xB5, 0x9B, 0xB1, 0xA8, 0x01, 0x9F, 0xA0, 0xE1, 0xE1,
+    0x00, 0xB1, 0xB5, 0x0D, 0xF3, 0xFF, 0x6A, 0x7D, 0xE3, 0xFF, 0xC4, 0x2D, 0xDA, 0xFF, 0xFA, 0x8D,
+    0x0C, 0xF9, 0xFF, 0x69, 0x6D, 0xFA, 0xFF, 0x68, 0x39, 0x2F, 0x51, 0x0E, 0x41, 0x46, 0x51, 0x3B,
+    0x19, 0x4A, 0x51, 0x52, 0x61, 0x22, 0x25, 0x27, 0x11, 0x35, 0x21, 0x12, 0x11, 0x12, 0x19, 0x1F,
+    0x20, 0x00, 0x00, 0x01, 0xEE, 0x04, 0xF9, 0xED, 0x01, 0x13, 0xF1, 0xED, 0xF5, 0xF4, 0x00, 0xF1,
+    0xEE, 0x11, 0x12, 0xF9, 0xEE, 0x01, 0x0D, 0x10, 0xF1, 0x11, 0x11, 0xEF, 0xF1, 0x11, 0x11, 0xEF,
+    0x11, 0x11, 0x21, 0x25, 0x00, 0x11, 0x13, 0xF5, 0xED, 0x01, 0x06, 0x00, 0xF1, 0xEE, 0x11, 0x12,
+    0xF1, 0xEE, 0x00, 0xF1, 0xED, 0x00, 0xE1, 0xEE, 0xF9, 0xE9, 0x05, 0xE1, 0xE1, 0xEF, 0x00, 0x00,
+    0xF9, 0x11, 0x11, 0xFC, 0x00, 0x10, 0x04, 0x21, 0x28, 0x19, 0x12, 0xF1, 0xFB, 0x00, 0x15, 0x17,
+    0x11, 0xEE, 0x00, 0x11, 0x25, 0x19, 0xFA, 0x01, 0x12, 0x00, 0xF1, 0xEE, 0x00, 0x00, 0x00, 0x05,
+    0x06, 0x09, 0xFA, 0x01, 0x12, 0x15, 0x19, 0x01, 0x11, 0x31, 0x12, 0x09, 0xFA, 0x11, 0x12, 0x00,
+    0x11, 0x12, 0x01, 0x13, 0x11, 0xED, 0xF1, 0xEE, 0xF0, 0x10, 0xF5, 0xEE, 0x01, 0x18, 0x01, 0xEE,
+    0x01, 0x37, 0x20, 0x19, 0x0C, 0x00, 0x05, 0x06, 0x01, 0xEE, 0xF0, 0x00, 0xF9, 0x12, 0x11, 0xFA,
+    0x10, 0xF1, 0xEE, 0x11, 0x12, 0x05, 0x19, 0x01, 0xED, 0x00, 0xF9, 0xEE, 0x01, 0xFA, 0x10, 0xF0,
+    0xF1, 0xED, 0x11, 0x13, 0xF1, 0xED, 0x11, 0x13, 0x11, 0xED, 0xF1, 0x13, 0x05, 0x06, 0x09, 0xFA,
+    0xF0, 0x01, 0x12, 0x20, 0x00, 0x00, 0xF0, 0x11, 0xEE, 0xF1, 0x12, 0x01, 0xDB, 0xE1, 0xEE, 0x15,
+    0x06, 0x08, 0x01, 0x0C, 0xF1, 0xEE, 0x21, 0x25, 0x00, 0x10, 0x00, 0x01, 0x12, 0x01, 0xEE, 0x01,
+    0x12, 0x00, 0x00, 0xF1, 0xDB, 0x05, 0x06, 0xF0, 0x09, 0x13, 0xF1, 0xE7, 0xF1, 0xEE, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x11, 0x25, 0x01, 0xED, 0x14, 0x11, 0x06, 0xF0, 0x19, 0x0D, 0xF0, 0x01, 0x12,
+    0x10, 0x11, 0x12, 0xF1, 0xEE, 0x00, 0x00, 0x01, 0x12, 0x11, 0xEE, 0x15, 0x2B, 0xF1, 0xEE, 0xF1,
+    0xED, 0x00, 0xF1, 0x13, 0x01, 0xED, 0xF1, 0x0C, 0x31, 0x07, 0x00, 0x00, 0x29, 0x0C, 0x00, 0xF0,
+    0x10, 0x05, 0xF4, 0x01, 0x12, 0x01, 0xEE, 0xF9, 0x0C, 0xF1, 0xED, 0x01, 0xEE, 0xF0, 0x01, 0xEE,
+    0xF5, 0xF3, 0x09, 0x0D, 0xF1, 0xDB, 0xF1, 0x12, 0x01, 0xEE, 0x21, 0x25, 0x11, 0x12, 0x00, 0xF1,
+    0xEE, 0xF0, 0x31, 0x24, 0x00, 0x00, 0xF1, 0xEE, 0x01, 0x12, 0x01, 0x13, 0x11, 0xED, 0x04, 0xF1,
+    0xF4, 0x00, 0x08, 0xF1, 0xFA, 0x01, 0xEE, 0xF1, 0xED, 0x15, 0xF4, 0xE1, 0xDC, 0xF1, 0x0C, 0x01,
+    0x06, 0x19, 0x0C, 0xF1, 0xEE, 0xF1, 0x12, 0x10, 0x05, 0x2B, 0x39, 0x0C, 0x10, 0xF1, 0xEE, 0xF1,
+    0xED, 0x11, 0x13, 0xF0, 0x11, 0xED, 0xF1, 0xEE, 0x10, 0x01, 0xFB, 0xF1, 0x05, 0xF1, 0xEE, 0x01,
+    0x12, 0xF1, 0xEE, 0xF9, 0xFB, 0x21, 0x12, 0x00, 0xF5, 0xEE, 0x01, 0x05, 0x04, 0x01, 0x3D, 0x19,
+    0xFA, 0x01, 0xDB, 0x01, 0xEE, 0x05, 0x18, 0x31, 0x25, 0x00, 0x11, 0x12, 0xE1, 0xEE, 0x19, 0x0C,
+    0xF1, 0xEE, 0x31, 0x24, 0xF0, 0x11, 0x13, 0xF1, 0xED, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xEE,
+    0x01, 0x12, 0x01, 0xFA, 0x01, 0xF4, 0x00, 0xF1, 0xEE, 0x00, 0x01, 0x12, 0x18, 0x01, 0x0C, 0x15,
+    0xF4, 0xF0, 0x11, 0x12, 0x01, 0x26, 0x11, 0xDA, 0xF0, 0x21, 0x26, 0x01, 0x13, 0x01, 0xDA, 0xE1,
+    0xED, 0x10, 0xF0, 0x11, 0x13, 0xF1, 0x13, 0x10, 0x10, 0x10, 0xF0, 0x00, 0xE1, 0xED, 0x15, 0xED,
+    0x01, 0x07, 0x15, 0x12, 0xF8, 0x19, 0x13, 0xF1, 0xFA, 0x10, 0x15, 0x1A, 0x21, 0x62, 0x41, 0x3D,
+    0x41, 0x2A, 0x11, 0x3E, 0x29, 0x0C, 0x31, 0x15, 0xFD, 0x0B, 0x00, 0x09, 0x0E, 0x0E, 0x00, 0xAE,
+    0x00, 0xED, 0x12, 0x00, 0x68, 0x0E, 0x03, 0x00, 0x97, 0x00, 0x2D, 0x03, 0x00, 0x31, 0xE1, 0xD3,
+    0x00, 0xF1, 0xCA, 0xF0, 0x01, 0x1B, 0x01, 0xE5, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x01, 0xE5, 0xF0,
+    0x11, 0x36, 0x01, 0xE5, 0x05, 0x25, 0x09, 0xDB, 0x10, 0xF0, 0x10, 0xF0, 0x00, 0xE1, 0xE5, 0x01,
+    0xE4, 0x01, 0x1C, 0xF0, 0x21, 0xE4, 0xF1, 0xE4, 0xF1, 0xE5, 0xF0, 0x11, 0xCA, 0xE9, 0x36, 0xF1,
+    0xC1, 0x04, 0x01, 0x3F, 0x11, 0x37, 0x30, 0x11, 0x37, 0x10, 0x01, 0xC9, 0xB2, 0x5E, 0xFF, 0x82,
+    0xF8, 0x7E, 0xFF, 0xA2, 0x6A, 0xFF, 0xD1, 0xB7, 0x08, 0xF1, 0xE0, 0xF1, 0xE8, 0xE5, 0xD6, 0xF1,
+    0xE8, 0x00, 0x09, 0xFA, 0x11, 0x17, 0x11, 0x18, 0xF5, 0xEF, 0x11, 0x18, 0x00, 0x11, 0x18, 0x00,
+    0x19, 0xFA, 0x21, 0x30, 0x00, 0xF5, 0x21, 0x00, 0x00, 0x00, 0x01, 0x18, 0x11, 0xE8, 0x01, 0x18,
+    0x30, 0xF0, 0x00, 0x09, 0xF9, 0xF0, 0xF5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x19, 0xE1, 0x05, 0x07,
+    0x05, 0x18, 0x08, 0x11, 0x18, 0xF1, 0xE8, 0x00, 0x11, 0x18, 0xE1, 0xD0, 0x00, 0x00, 0xF9, 0xDF,
+    0x05, 0x08, 0x09, 0xF8, 0x00, 0x05, 0x08, 0x21, 0x31, 0x00, 0x19, 0x11, 0x01, 0x07, 0x04, 0xF5,
+    0xE8, 0x08, 0x01, 0x18, 0x00, 0xF9, 0xF9, 0x10, 0x05, 0x07, 0x11, 0xE8, 0xF1, 0xE8, 0x11, 0x18,
+    0x01, 0x08, 0xF1, 0xF8, 0x19, 0x11, 0xF5, 0x20, 0x10, 0x00, 0x00, 0x09, 0xE7, 0x04, 0x00, 0xF1,
+    0xE8, 0x00, 0x00, 0x01, 0x18, 0x09, 0xF9, 0x00, 0x05, 0x20, 0x21, 0x18, 0x01, 0xE8, 0x10, 0xE1,
+    0xE7, 0x00, 0x00, 0x00, 0x11, 0x19, 0xF1, 0xE7, 0x10, 0x00, 0x01, 0x19, 0x00, 0x01, 0x18, 0x01,
+    0xE8, 0xF1, 0x18, 0x19, 0xE8, 0xF4, 0x01, 0xE7, 0x01, 0xE8, 0x00, 0xF0, 0x11, 0x18, 0xE9, 0xC9,
+    0x11, 0x18, 0xF5, 0xEF, 0x11, 0x18, 0x00, 0x11, 0x18, 0x00, 0xF9, 0xE1, 0x00, 0xF5, 0xEF, 0x00,
+    0x21, 0x30, 0x00, 0x00, 0xF9, 0xE1, 0x11, 0x18, 0xF1, 0xE8, 0xE5, 0xD6, 0xD1, 0xB6, 0x00, 0x00,
+    0x11, 0x18, 0x09, 0xFA, 0x15, 0x18, 0xE1, 0xD6, 0xE1, 0xE8, 0xF0, 0x00, 0x19, 0xF9, 0xF5, 0xD8,
+    0x21, 0x2F, 0x11, 0x18, 0xF1, 0x18, 0x19, 0x32, 0x31, 0x2A, 0x31, 0x18, 0x76, 0xAE, 0x00, 0x52,
+    0xF7, 0x00, 0x82, 0x0A, 0xA5, 0x00, 0x21, 0x37, 0x31, 0x39, 0x00, 0xF0, 0x00, 0xE1, 0xC7, 0x05,
+    0x0B, 0x09, 0xF5, 0x00, 0xF0, 0x01, 0xC9, 0xF1, 0x1B, 0x11, 0xE5, 0x01, 0x1B, 0x00, 0xF1, 0xE5,
+    0xF1, 0x1B, 0x21, 0xC9, 0x01, 0x1C, 0xF0, 0x18, 0xF5, 0x37, 0x01, 0xE4, 0x11, 0x1C, 0x10, 0xF1,
+    0xC9, 0xE1, 0xE4, 0xF0, 0x10, 0x01, 0x1C, 0x15, 0xE4, 0x01, 0x0B, 0x01, 0x1C, 0xF9, 0xD9, 0x00,
+    0x11, 0x37, 0x01, 0xE5, 0x01, 0x1B, 0x01, 0xC9, 0x11, 0x1C, 0x01, 0x37, 0x01, 0xE4, 0x05, 0x27,
+    0x00, 0x20, 0xF9, 0xF5, 0x00, 0x01, 0x1C, 0x29, 0x12, 0x05, 0xEE, 0xF5, 0xEF, 0x00, 0xE1, 0x1D,
+    0x19, 0xD8, 0xF0, 0x00, 0x11, 0xE4, 0x01, 0x1C, 0x01, 0x1C, 0x11, 0x1D, 0x00, 0x01, 0xC7, 0xF0,
+    0x00, 0x00, 0x00, 0x08, 0x01, 0xF5, 0x05, 0xC9, 0xE1, 0x0B, 0x00, 0x00, 0x10, 0xE0, 0x21, 0xE4,
+    0xF0, 0xF1, 0x27, 0x11, 0x10, 0x05, 0x27, 0x19, 0xF5, 0x18, 0xF1, 0xDA, 0x15, 0x0A, 0xF5, 0x27,
+    0x10, 0x01, 0xE4, 0x09, 0x11, 0xF9, 0xBE, 0xF5, 0xEF, 0xF1, 0x1C, 0x10, 0xF1, 0xE4, 0xF9, 0xDA,
+    0xF1, 0x93, 0xA2, 0x60, 0xFF, 0x96, 0x4E, 0xFF, 0x82, 0xF8, 0x43, 0xFF, 0xA2, 0x79, 0xFF, 0x91,
+    0x9E, 0xD2, 0x68, 0xFF, 0x99, 0xBE, 0xC6, 0x7A, 0xFF, 0xA1, 0xCC, 0xD1, 0xCB, 0xC1, 0xBE, 0xC1,
+    0xC0, 0xE1, 0xE2, 0xB1, 0xB9, 0x01, 0xE6, 0xE0, 0xC1, 0xCF, 0x82, 0x0C, 0x00, 0x01, 0x6A, 0x8C,
+    0x00, 0x81, 0x0D, 0x59, 0x22, 0x8E, 0x00, 0x66, 0x88, 0x00, 0x61, 0x1C, 0x41, 0x3F, 0x00, 0x01,
+    0x2F, 0x01, 0x17, 0x01, 0x61, 0x82, 0x08, 0x11, 0x01, 0x82, 0x0C, 0x27, 0x01, 0x82, 0x0C, 0xA4,
+    0x00, 0x41, 0x73, 0x01, 0xA9, 0x01, 0x1D, 0xF0, 0x01, 0xE3, 0x00, 0xF1, 0xC8, 0xE1, 0xE5, 0x01,
+    0x1B, 0x10, 0x00, 0xF5, 0xD4, 0x09, 0xF5, 0xF9, 0xF6, 0x01, 0xE4, 0xF0, 0xF0, 0x25, 0x26, 0x00,
+    0x01, 0xE5, 0x10, 0xD1, 0xE5, 0x08, 0x05, 0xE5, 0xE1, 0xE4, 0xF1, 0xC9, 0x82, 0xF7, 0x2C, 0xFF,
+    0x9A, 0x4A, 0xFF, 0x92, 0x55, 0xFF, 0x96, 0x64, 0xFF, 0xD2, 0x67, 0xFF, 0x91, 0xC2, 0xC1, 0xB0,
+    0xDA, 0x68, 0xFF, 0x81, 0xF8, 0xCC, 0xC1, 0xBF, 0xD1, 0xD1, 0xD1, 0xD3, 0x05, 0xCA, 0xC9, 0xF3,
+    0xF1, 0xFE, 0xE1, 0xE7, 0x81, 0x09, 0x7C, 0x46, 0x5E, 0x01, 0x82, 0x10, 0x90, 0x00, 0x82, 0x0C,
+    0xE0, 0x00, 0x81, 0x08, 0x47, 0x62, 0x93, 0x00, 0x41, 0x62, 0x22, 0x80, 0x00, 0x45, 0x4E, 0x41,
+    0x3E, 0x01, 0x37, 0x19, 0x11, 0x30, 0xF0, 0xF0, 0xF1, 0xAF, 0xF1, 0xCB, 0xF0, 0xE1, 0xE5, 0xF1,
+    0xE6, 0x10, 0x01, 0xE7, 0xF1, 0x19, 0xF4, 0x29, 0xE7, 0xF0, 0x09, 0x10, 0xF5, 0xE7, 0x01, 0x09,
+    0x05, 0xEE, 0x00, 0xF9, 0xF7, 0x11, 0x1B, 0x11, 0x19, 0x10, 0x05, 0x09, 0x19, 0x2C, 0x11, 0x35,
+    0x11, 0xF7, 0xE1, 0xD4, 0x01, 0x35, 0x05, 0xEE, 0x09, 0xE5, 0x01, 0x13, 0x00, 0x00, 0x10, 0x01,
+    0xE5, 0x01, 0x1B, 0x00, 0x01, 0xE5, 0x11, 0x1B, 0xE1, 0xE5, 0x21, 0x35, 0x00, 0x15, 0x09, 0xF9,
+    0xF7, 0x08, 0xF1, 0xDC, 0x00, 0xF5, 0x0A, 0x01, 0xE5, 0x00, 0x01, 0xE5, 0xF1, 0x1B, 0x01, 0xE5,
+    0x00, 0xF1, 0xB2, 0xF5, 0x3D, 0x01, 0xCC, 0x01, 0x1B, 0xF9, 0xDC, 0xF1, 0xCD, 0xE1, 0xB5, 0xD1,
+    0xCF, 0xC1, 0xB7, 0xC2, 0x57, 0xFF, 0xA2, 0x77, 0xFF, 0x91, 0xA9, 0xC1, 0x84, 0xA1, 0xB2, 0xD1,
+    0xC9, 0xD1, 0xB8, 0xD1, 0xAC, 0xDD, 0xFD, 0xFF, 0xC8, 0xDD, 0xE9, 0xFF, 0xEC, 0x0D, 0xF3, 0xFF,
+    0xAF, 0xED, 0xED, 0xFF, 0x14, 0x3D, 0xF9, 0xFF, 0xE6, 0x4D, 0xFA, 0xFF, 0x25, 0x39, 0x1E, 0x39,
+    0x51, 0x41, 0x0C, 0x61, 0x3F, 0x41, 0x36, 0x01, 0x1B, 0x28, 0x21, 0x18, 0x01, 0x0E, 0x01, 0xF2,
+    0x11, 0x0E, 0x21, 0x1D, 0x21, 0x1D, 0x11, 0x0E, 0x11, 0x0F, 0x00, 0x10, 0x11, 0x1E, 0x05, 0xF1,
+    0xF8, 0x00, 0x00, 0x0C, 0x07, 0x00, 0x1D, 0x0D, 0x00, 0x47, 0x1D, 0x15, 0x00, 0x75, 0x1D, 0x03,
+    0x00, 0x3C, 0x0D, 0x03, 0x00, 0x37, 0x01, 0x07, 0x00, 0x00, 0x05, 0xF3, 0x10, 0xF1, 0xEA, 0xF0,
+    0xF0, 0xF1, 0xEC, 0x00, 0x10, 0x00, 0x00, 0xF1, 0x14, 0x10, 0x00, 0x00, 0x01, 0xEC, 0x15, 0x06,
+    0x09, 0x15, 0x01, 0xF9, 0x00, 0x11, 0x16, 0x00, 0xF1, 0xEA, 0x10, 0x00, 0x01, 0x16, 0x00, 0x11,
+    0x15, 0xF1, 0xEB, 0xF1, 0x2A, 0x11, 0xEB, 0xF0, 0x28, 0xF1, 0xE3, 0x05, 0x15, 0x01, 0x1D, 0x00,
+    0x01, 0xD6, 0x00, 0x00, 0x10, 0x11, 0x2A, 0x00, 0x00, 0x00, 0xF1, 0xEB, 0x00, 0xF1, 0xEB, 0x10,
+    0x00, 0x01, 0x15, 0x00, 0xF0, 0x01, 0x15, 0x11, 0xEB, 0x05, 0x06, 0x00, 0x01, 0xEB, 0x11, 0x15,
+    0x09, 0xFA, 0x01, 0x15, 0xF1, 0xEB, 0xF1, 0xEB, 0x00, 0x00, 0xF1, 0xEA, 0x21, 0x2B, 0xF1, 0xEB,
+    0x11, 0x2A, 0x05, 0x07, 0x01, 0x15, 0x19, 0xE4, 0xF0, 0x10, 0x05, 0xF1, 0x08, 0x05, 0xEB, 0x09,
+    0x24, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xEB, 0x19, 0x15, 0x11, 0x0E, 0x11, 0x14, 0x15, 0x1C,
+    0xF1, 0xEC, 0x00, 0x00, 0xF1, 0xEC, 0xF1, 0xEA, 0x00, 0xF1, 0xEB, 0x05, 0x06, 0x11, 0x16, 0x11,
+    0x15, 0xF9, 0x0E, 0x11, 0x14, 0x11, 0xEC, 0x01, 0x14, 0x01, 0xEC, 0x00, 0x00, 0x00, 0x11, 0x14,
+    0xF1, 0xEC, 0x10, 0x01, 0xEC, 0x01, 0x14, 0x00, 0x01, 0x14, 0x00, 0x01, 0x2A, 0x01, 0xEA, 0x00,
+    0x10, 0x00, 0x10, 0xF1, 0xEC, 0x01, 0x14, 0x01, 0xEC, 0xF0, 0x01, 0xEC, 0xF0, 0xF1, 0x14, 0x10,
+    0xF1, 0xEC, 0x00, 0x10, 0x09, 0xE4, 0x15, 0x1C, 0x01, 0xEC, 0xF0, 0xF0, 0x01, 0x14, 0x01, 0x14,
+    0x11, 0x2A, 0x11, 0xEA, 0x10, 0x00, 0x00, 0x21, 0x16, 0x00, 0x09, 0x14, 0x01, 0xF8, 0x05, 0x08,
+    0x11, 0x15, 0x05, 0xDD, 0xF9, 0xFA, 0x01, 0x14, 0xF1, 0xEC, 0x01, 0x14, 0x00, 0xF5, 0x08, 0x10,
+    0x09, 0xEA, 0xF1, 0xE4, 0xF1, 0xEC, 0xF1, 0xEC, 0xF1, 0xEC, 0xF1, 0xEA, 0x09, 0xF9, 0x05, 0x07,
+    0x00, 0x19, 0x0E, 0x11, 0x14, 0xF5, 0xF4, 0x00, 0xF1, 0xEA, 0x11, 0x16, 0x19, 0x14, 0x15, 0x14,
+    0x05, 0x07, 0x10, 0x00, 0x09, 0xF9, 0x00, 0x01, 0x14, 0xF1, 0xEC, 0x01, 0x14, 0x00, 0x01, 0x16,
+    0x11, 0xEA, 0xF8, 0x05, 0xEC, 0x00, 0x00, 0xF1, 0xEC, 0x11, 0x14, 0x00, 0x00, 0x00, 0x05, 0x07,
+    0x08, 0x01, 0xF9, 0xE1, 0xEC, 0x01, 0x14, 0x01, 0xEC, 0xF1, 0xEC, 0x20, 0x00, 0x00, 0x09, 0xF8,
+    0x11, 0x14, 0xF5, 0xEC, 0x05, 0x37, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x11, 0xF8, 0x01, 0x08, 0x01,
+    0xD8, 0xF0, 0x01, 0xEA, 0xF9, 0xF9, 0xF0, 0xF5, 0x07, 0x00, 0x01, 0x16, 0x10, 0x11, 0x14, 0x10,
+    0x11, 0xEC, 0xF1, 0xEA, 0x00, 0xE1, 0xEB, 0x09, 0x0E, 0xE1, 0xD5, 0xF0, 0x05, 0x1D, 0x00, 0x15,
+    0x1C, 0x29, 0xF9, 0x00, 0x00, 0x10, 0x11, 0x16, 0x15, 0x14, 0xF1, 0x1B, 0x18, 0x01, 0xF9, 0x01,
+    0x14, 0x01, 0xEC, 0x01, 0x2A, 0x21, 0xEA, 0x00, 0xF9, 0xF8, 0x00, 0x25, 0x2A, 0x01, 0x1D, 0x11,
+    0xEB, 0x01, 0xEC, 0xF1, 0xEA, 0xF0, 0x00, 0xF1, 0x16, 0xF1, 0xEA, 0x01, 0xEC, 0xF0, 0x01, 0xEC,
+    0xF0, 0x19, 0xF8, 0x05, 0x08, 0x11, 0x14, 0x00, 0x00, 0xF1, 0xEC, 0x01, 0x14, 0x11, 0x14, 0x01,
+    0xEC, 0x00, 0xF1, 0xEC, 0x01, 0xEC, 0x00, 0xF1, 0xEA, 0x11, 0x16, 0x01, 0x14, 0xF0, 0x11, 0x14,
+    0x00, 0x11, 0x14, 0x01, 0xEC, 0x11, 0x1C, 0x01, 0xF8, 0xF5, 0xEC, 0x01, 0x07, 0x08, 0x19, 0x05,
+    0x05, 0x08, 0xF5, 0xF3, 0x11, 0xEB, 0xF0, 0x09, 0x0E, 0x18, 0xF4, 0x01, 0x14, 0x01, 0xEC, 0x00,
+    0xF1, 0xEC, 0xE1, 0xC1, 0xE1, 0xC1, 0xB1, 0xAF, 0xB1, 0xB2, 0xD1, 0x91, 0xA1, 0xCB, 0xE1, 0xAC,
+    0xB1, 0xE0, 0xF9, 0xF0, 0xE4, 0x21, 0xF0, 0x11, 0x20, 0xF1, 0x10, 0x21, 0xF0, 0x29, 0x30, 0x01,
+    0x0D, 0x25, 0x14, 0x11, 0x6A, 0x51, 0x70, 0x68, 0x41, 0x49, 0x31, 0x3C, 0x15, 0x31, 0x25, 0x2A,
+    0x11, 0x1C, 0x19, 0x22, 0x10, 0x10, 0x00, 0xF1, 0xEC, 0xF1, 0xEC, 0x15, 0x14, 0x11, 0x1B, 0x00,
+    0x19, 0x0D, 0x00, 0x00, 0x00, 0x04, 0xF1, 0x08, 0x09, 0xE4, 0xF0, 0x11, 0x3E, 0x21, 0xEC, 0x05,
+    0x06, 0x10, 0x09, 0xE4, 0x11, 0x2A, 0xF0, 0x11, 0x15, 0xF1, 0xEB, 0x10, 0xF0, 0x01, 0xEC, 0x00,
+    0xF0, 0xF1, 0xEA, 0xF1, 0xEC, 0xF0, 0x08, 0x11, 0xF8, 0x01, 0xEC, 0xF5, 0x08, 0x05, 0xEC, 0xF1,
+    0x06, 0xF9, 0xEB, 0x01, 0xF9, 0x09, 0xF9, 0xF1, 0x15, 0x15, 0xF2, 0xE0, 0x31, 0x16, 0x01, 0xEA,
+    0x01, 0xEB, 0xF0, 0x00, 0xF0, 0x01, 0x15, 0x00, 0x01, 0xEB, 0xF0, 0x01, 0xEB, 0x01, 0x15, 0x20,
+    0x21, 0x2B, 0x10, 0x19, 0x3C, 0x21, 0x37, 0x25, 0x3F, 0x51, 0x4B, 0x10, 0x05, 0x09, 0xF9, 0xF7,
+    0x10, 0x11, 0x16, 0x00, 0x01, 0x2E, 0x00, 0x11, 0xE9, 0xE1, 0x2D, 0x20, 0x11, 0x18, 0x10, 0x11,
+    0x17, 0xF0, 0x11, 0xE9, 0x01, 0x17, 0x00, 0x11, 0x17, 0x00, 0x01, 0x30, 0x11, 0xE8, 0x00, 0x00,
+    0x00, 0x01, 0xE8, 0x01, 0x18, 0xE5, 0xDB, 0x29, 0x17, 0xE1, 0x0E, 0x11, 0xE8, 0x00, 0xF0, 0x01,
+    0x18, 0x11, 0xD1, 0x00, 0xF0, 0x10, 0xF4, 0x11, 0x21, 0xF0, 0x09, 0xE9, 0x01, 0xF6, 0x00, 0x01,
+    0xE9, 0x00, 0x01, 0x17, 0x05, 0xF2, 0x11, 0x2F, 0x09, 0xF6, 0x01, 0x18, 0x01, 0xE8, 0x00, 0x00,
+    0xF5, 0xF3, 0x09, 0xF6, 0x01, 0xE9, 0x00, 0xF0, 0x11, 0x17, 0x04, 0x08, 0xF0, 0x10, 0xF0, 0x10,
+    0x05, 0x0A, 0x01, 0xD1, 0x09, 0x25, 0xE1, 0xE9, 0x15, 0xE8, 0xF1, 0xF4, 0xF9, 0x0C, 0x05, 0x0A,
+    0x09, 0xEA, 0xF9, 0xD6, 0xF5, 0xE9, 0xF1, 0x09, 0x10, 0x05, 0x0A, 0x09, 0x0D, 0x01, 0xE9, 0x00,
+    0xF1, 0xEA, 0xF0, 0x11, 0x16, 0x01, 0xEA, 0xF1, 0xEA, 0xF1, 0xD4, 0xF9, 0xF7, 0xD5, 0xA0, 0xB1,
+    0x98, 0xB1, 0x83, 0xA1, 0xA3, 0xB9, 0xBC, 0xD1, 0x82, 0xA1, 0xDE, 0xD5, 0xD3, 0xE1, 0xB1, 0xA1,
+    0xD2, 0xF1, 0xF1, 0xE1, 0xE3, 0x11, 0x0F, 0xF1, 0x1D, 0x31, 0x0F, 0x21, 0x0F, 0x21, 0x1F, 0x01,
+    0x20, 0x01, 0xE0, 0x10, 0xF1, 0x40, 0x51, 0x10, 0x11, 0x11, 0x00, 0x10, 0x01, 0x10, 0xE0, 0x11,
+    0xF0, 0x10, 0xF0, 0x11, 0x10, 0xF9, 0x0D, 0x11, 0xEF, 0x15, 0x04, 0x01, 0x12, 0xE1, 0x11, 0x30,
+    0x00, 0x00, 0x10, 0xF0, 0xF0, 0x01, 0xEF, 0x18, 0xF1, 0xFB, 0x00, 0x05, 0x05, 0xF0, 0x01, 0xEE,
+    0x01, 0xDF, 0xF1, 0x11, 0xF1, 0xEF, 0x00, 0x15, 0x11, 0x21, 0x14, 0x11, 0x23, 0xF1, 0x11, 0x19,
+    0xEB, 0x29, 0x0C, 0x15, 0x24, 0x01, 0x05, 0x00, 0x11, 0x12, 0xF1, 0x29, 0x21, 0xE9, 0x21, 0x25,
+    0x00, 0x15, 0x18, 0x11, 0x14, 0x20, 0x09, 0x20, 0x11, 0x15, 0x21, 0x27, 0xF1, 0xEC, 0x01, 0x14,
+    0x10, 0x20, 0x09, 0x22, 0xF1, 0xEC, 0xF1, 0xEC, 0x05, 0x06, 0x10, 0x00, 0x01, 0x14, 0x09, 0xFA,
+    0xF5, 0x06, 0x01, 0xEC, 0x20, 0xF1, 0xEC, 0xF1, 0x14, 0xF1, 0xEC, 0xF1, 0xED, 0x00, 0x00, 0x00,
+    0xF5, 0x19, 0x09, 0xFA, 0x01, 0xED, 0x10, 0x01, 0x13, 0x00, 0x01, 0x14, 0x11, 0xEC, 0x00, 0x19,
+    0x14, 0x01, 0xFA, 0xF5, 0x06, 0x00, 0xF1, 0xD9, 0x21, 0x27, 0x01, 0xEC, 0x11, 0x3C, 0x01, 0xEC,
+    0xF1, 0xEC, 0x01, 0x06, 0xF1, 0xE6, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01, 0xEC, 0xE1, 0xD9, 0x20,
+    0xF0, 0xF1, 0x13, 0x01, 0xED, 0x11, 0x0D, 0x21, 0x1A, 0x00, 0x21, 0x28, 0x01, 0x15, 0x00, 0xF1,
+    0xEB, 0xF1, 0xEC, 0x21, 0x14, 0xF1, 0xEC, 0x01, 0x14, 0xF1, 0xEC, 0x00, 0x00, 0x11, 0x14, 0x0C,
+    0x05, 0x00, 0xED, 0x24, 0x00, 0x5C, 0xFE, 0x0F, 0x00, 0xCA, 0x00, 0xED, 0x0C, 0x00, 0xE9, 0xFD,
+    0x03, 0x00, 0x63, 0xED, 0x02, 0x00, 0xCE, 0xF1, 0x0A, 0xF1, 0xC4, 0x11, 0x1D, 0x00, 0xF1, 0xE3,
+    0x00, 0x20, 0x01, 0x3C, 0x00, 0xF4, 0x2D, 0x0A, 0x00, 0x6B, 0xEE, 0x1A, 0x00, 0x8A, 0x00, 0xDE,
+    0x07, 0x00, 0xB8, 0x00, 0xFD, 0x09, 0x00, 0xAA, 0x1D, 0x0B, 0x00, 0x13, 0xCD, 0x02, 0x00, 0x3A,
+    0xE5, 0xA3, 0xD5, 0xB4, 0xF2, 0xB4, 0x00, 0xC2, 0x76, 0xFE, 0x56, 0xE3, 0x00, 0xD2, 0xD5, 0xFE,
+    0xC9, 0x53, 0x01, 0xA3, 0x72, 0xFD, 0x00, 0x81, 0xF8, 0x58, 0x02, 0x82, 0xFE, 0x86, 0x08, 0xB1,
+    0x00, 0x12, 0xDA, 0x00, 0xC2, 0x52, 0xFF, 0x2A, 0xFA, 0x00, 0x12, 0x7A, 0xFF, 0x41, 0xAA, 0x22,
+    0x68, 0x01, 0xA1, 0x30, 0x52, 0x93, 0xFE, 0xF2, 0xDF, 0x00, 0xC1, 0xA5, 0x39, 0x20, 0xC5, 0x6A,
+    0x02, 0xF2, 0xFE, 0x82, 0x08, 0x3D, 0x01, 0xF0, 0xA0, 0x52, 0xC3, 0xFE, 0xD2, 0x84, 0x00, 0x11,
+    0xA7, 0x02, 0x86, 0x00, 0xB6, 0xCB, 0x00, 0xFA, 0x2F, 0xFE, 0x72, 0x06, 0x01, 0x81, 0xF8, 0x5D,
+    0x52, 0x4A, 0xFF, 0x25, 0xE0, 0x02, 0x88, 0x00, 0x51, 0xD2, 0xD1, 0x7C, 0xB2, 0xCD, 0x00, 0xFA,
+    0x25, 0xFE, 0x80, 0x08, 0xC2, 0xB1, 0x00, 0xE2, 0x7A, 0xFF, 0xE1, 0x2D, 0x01, 0xA8, 0x70, 0xF2,
+    0x0E, 0x01, 0x85, 0xF7, 0x5F, 0x32, 0xA0, 0xFE, 0x42, 0x85, 0x00, 0xC1, 0x5C, 0x7D, 0xFE, 0xFF,
+    0x4F, 0xC5, 0xD1, 0xE6, 0x1D, 0xFF, 0x81, 0x08, 0xB6, 0xE2, 0x6B, 0x01, 0x99, 0x4F, 0x32, 0xE9,
+    0xFE, 0xF2, 0x7C, 0xFF, 0xE1, 0x2B, 0x46, 0x95, 0x00, 0x81, 0xF8, 0xA5, 0xFA, 0xD1, 0xFE, 0x82,
+    0x0B, 0xD8, 0x01, 0x82, 0xF6, 0x4A, 0xFF, 0x02, 0xFD, 0xFE, 0x82, 0x09, 0x2F, 0x01, 0xB5, 0x89,
+    0x11, 0x2B, 0xCA, 0xA7, 0x00, 0xE2, 0x4D, 0xFE, 0x82, 0x09, 0x85, 0x01, 0x92, 0xEA, 0x00, 0x42,
+    0x90, 0xFE, 0x41, 0xD5, 0xC5, 0x38, 0x29, 0x4C, 0xC1, 0x2D, 0xF2, 0xFA, 0xFE, 0x81, 0x08, 0xAA,
+    0xE2, 0x5C, 0x01, 0x90, 0x72, 0x24, 0xFF, 0x91, 0xAB, 0x32, 0x80, 0x00, 0x56, 0xDF, 0x00, 0x92,
+    0xD8, 0xFE, 0x82, 0x08, 0x56, 0xFF, 0xD2, 0x85, 0x01, 0xA9, 0x5C, 0x72, 0xBD, 0xFE, 0xB1, 0x2A,
+    0x01, 0x2B, 0x4E, 0x0A, 0x00, 0xC8, 0x00, 0x8E, 0xF8, 0x03, 0x00, 0xFB, 0xFE, 0x85, 0x08, 0x0E,
+    0x26, 0xFB, 0x01, 0x82, 0xF4, 0xB7, 0xFD, 0x86, 0x09, 0x9A, 0x00, 0xF2, 0xF5, 0x00, 0x00, 0xF1,
+    0x66, 0xE2, 0x07, 0xFF, 0x71, 0xCF, 0x12, 0xC7, 0x01, 0x82, 0xF6, 0x08, 0xFE, 0x82, 0x0A, 0x92,
+    0x00, 0xF2, 0x31, 0x01, 0xCA, 0x00, 0xFF, 0xE1, 0xBF, 0xB6, 0x1F, 0xFF, 0x89, 0x08, 0x51, 0x46,
+    0x06, 0x02, 0x92, 0xA2, 0x00, 0x22, 0x5B, 0xFE, 0x62, 0x39, 0x01, 0xA2, 0xC7, 0xFE, 0x00, 0xF2,
+    0x03, 0x01, 0x02, 0xCB, 0xFE, 0x81, 0x09, 0x9F, 0xDA, 0x96, 0x01, 0xA1, 0xEC, 0xF2, 0x9E, 0xFE,
+    0x21, 0x62, 0x05, 0xCE, 0x32, 0xDC, 0x00, 0x80, 0xF8, 0x02, 0x72, 0xFE, 0x82, 0x09, 0xAF, 0x01,
+    0x81, 0xF7, 0x14, 0x22, 0x9F, 0xFE, 0x62, 0xC6, 0x00, 0xE0, 0x21, 0x66, 0xCA, 0xD7, 0x00, 0xE2,
+    0xED, 0xFD, 0x75, 0xDF, 0x22, 0xFD, 0x01, 0x82, 0xF8, 0x64, 0xFE, 0x41, 0x31, 0xF9, 0x65, 0x11,
+    0x8A, 0x26, 0x11, 0x01, 0x82, 0xF8, 0xA2, 0x00, 0x32, 0x5E, 0xFE, 0x82, 0x09, 0xD7, 0x01, 0x00,
+    0xB2, 0xF4, 0xFE, 0x11, 0x35, 0xD2, 0x65, 0xFF, 0x41, 0x9B, 0x12, 0x6B, 0x01, 0x81, 0xF7, 0x37,
+    0x12, 0x2D, 0xFE, 0x60, 0x02, 0x31, 0x01, 0xE1, 0x98, 0xE1, 0x33, 0xE2, 0x04, 0xFF, 0x81, 0x08,
+    0xD0, 0xFA, 0x96, 0x01, 0x81, 0xF8, 0xB7, 0x62, 0xA3, 0xFE, 0xF2, 0xF7, 0x00, 0xE2, 0x69, 0xFF,
+    0x22, 0x97, 0x00, 0xC5, 0x66, 0x62, 0xE3, 0xFE, 0x1A, 0x52, 0x01, 0x81, 0xF6, 0x98, 0x06, 0x84,
+    0xFE, 0x82, 0x09, 0xF5, 0x00, 0xC1, 0x33, 0x10, 0xEA, 0xBC, 0x00, 0x02, 0xCE, 0xFE, 0x85, 0x08,
+    0xB0, 0xE2, 0x96, 0x01, 0x82, 0xF8, 0x63, 0xFF, 0x52, 0xA5, 0xFE, 0xF2, 0x28, 0x01, 0xF2, 0x09,
+    0xFF, 0xE1, 0x61, 0x82, 0xF7, 0x5B, 0xFE, 0x82, 0x09, 0xA5, 0x01, 0x81, 0xF6, 0x9F, 0x82, 0x08,
+    0xBC, 0xFE, 0x3A, 0xC5, 0x01, 0xA1, 0xA0, 0x42, 0x70, 0xFF, 0xD2, 0xF0, 0x00, 0x26, 0x7F, 0xFF,
+    0x32, 0x92, 0x00, 0xD2, 0x6E, 0xFF, 0xFD, 0xFB, 0xFF, 0x85, 0x1D, 0xEE, 0xFF, 0xC4, 0x2D, 0xF9,
+    0xFF, 0xA7, 0x3D, 0xF8, 0xFF, 0x44, 0x0E, 0xFE, 0xFF, 0x91, 0x00, 0x4D, 0xFE, 0xFF, 0xCE, 0x39,
+    0x10, 0x11, 0x77, 0xF9, 0xCD, 0x15, 0x5A, 0x31, 0x51, 0xE0, 0x00, 0x09, 0xAF, 0x11, 0xCD, 0xF1,
+    0x27, 0xF1, 0xB2, 0x01, 0xDA, 0x05, 0x4D, 0xE8, 0xF1, 0x8B, 0x21, 0x28, 0xF1, 0x26, 0x01, 0xDA,
+    0xF1, 0x26, 0x15, 0x33, 0x09, 0xA7, 0x21, 0xD8, 0xF1, 0x4E, 0xF5, 0x27, 0x11, 0xE4, 0x09, 0x28,
+    0x11, 0x43, 0x20, 0x31, 0x28, 0xF1, 0xD8, 0xF1, 0x28, 0xE1, 0xD8, 0x05, 0xE4, 0x00, 0xE8, 0x01,
+    0xA6, 0x25, 0x0B, 0x00, 0x01, 0x4F, 0x11, 0x29, 0x19, 0x1B, 0x00, 0xD0, 0x15, 0xBC, 0x11, 0xD9,
+    0x01, 0x78, 0x10, 0x19, 0xCB, 0x11, 0x28, 0x15, 0x53, 0xF1, 0x0D, 0xF0, 0x01, 0xD7, 0x09, 0xF2,
+    0x01, 0x2A, 0xF1, 0xD6, 0xF1, 0xAF, 0x25, 0xD8, 0xE1, 0x0C, 0x09, 0x29, 0x04, 0x19, 0xCB, 0x01,
+    0x50, 0xE1, 0x29, 0x21, 0x2A, 0x15, 0xE4, 0x01, 0xD6, 0xE9, 0xCB, 0xF1, 0xD8, 0x20, 0x01, 0x50,
+    0xD1, 0xD8, 0x15, 0x0D, 0xF1, 0xB0, 0x09, 0x1B, 0x00, 0xF5, 0xBD, 0x11, 0xDA, 0xF1, 0x26, 0xD9,
+    0xCF, 0x11, 0xD8, 0xF1, 0x28, 0x01, 0xB2, 0x20, 0x11, 0x74, 0xD0, 0x0D, 0x14, 0x00, 0xB6, 0xFD,
+    0x13, 0x00, 0x74, 0xCE, 0x04, 0x00, 0xA2, 0x00, 0x5E, 0x02, 0x00, 0x5C, 0xFF, 0xE6, 0x74, 0x01,
+    0xB6, 0xFF, 0xFE, 0xF9, 0x31, 0xD6, 0x09, 0xFF, 0x82, 0x08, 0x6F, 0x01, 0x81, 0xF7, 0x35, 0x12,
+    0x6B, 0xFE, 0x82, 0x09, 0xCA, 0x01, 0x91, 0xCB, 0x2A, 0x22, 0xFF, 0x32, 0x01, 0x01, 0xE2, 0x30,
+    0xFF, 0x32, 0x9B, 0x00, 0x92, 0xA0, 0x00, 0x42, 0xC5, 0xFE, 0x72, 0x6B, 0xFF, 0xE2, 0x9A, 0x01,
+    0xC2, 0x2E, 0xFF, 0x10, 0x05, 0x45, 0x41, 0xCD, 0x12, 0x41, 0x01, 0x81, 0xF6, 0x39, 0x12, 0xEE,
+    0xFD, 0x82, 0x08, 0xA2, 0x01, 0xA0, 0x32, 0x5E, 0xFF, 0xE1, 0xCB, 0xF9, 0x99, 0x61, 0x8D, 0x12,
+    0xD4, 0x01, 0x86, 0xF6, 0x08, 0xFE, 0x81, 0x09, 0x33, 0xD2, 0x00, 0x01, 0xC1, 0x98, 0x31, 0x33,
+    0xB2, 0x02, 0xFF, 0x71, 0x33, 0x32, 0xD9, 0x01, 0x82, 0xF4, 0x27, 0xFF, 0x82, 0x08, 0x3A, 0xFE,
+    0xE2, 0x5E, 0x01, 0xB9, 0x8A, 0x31, 0x31, 0x01, 0xCF, 0x52, 0x6B, 0xFF, 0x02, 0x96, 0x01, 0x82,
+    0xF6, 0x09, 0xFE, 0x80, 0x0A, 0xE6, 0x8E, 0x01, 0xA2, 0xE2, 0xFE, 0x52, 0x96, 0x00, 0xD1, 0xCE,
+    0x42, 0xCB, 0x00, 0x92, 0xA0, 0xFE, 0x89, 0x08, 0xC1, 0x22, 0x2C, 0x02, 0x82, 0xF5, 0xD4, 0xFD,
+    0x81, 0x08, 0x61, 0xF2, 0xF9, 0x00, 0xD6, 0x7A, 0xFF, 0xF2, 0x98, 0x00, 0x1A, 0x68, 0xFF, 0x71,
+    0x22, 0x32, 0xDB, 0x01, 0x82, 0xF5, 0xC1, 0xFD, 0x71, 0xCF, 0x02, 0x96, 0x01, 0xC2, 0x63, 0xFF,
+    0x11, 0x34, 0xF1, 0x99, 0x55, 0x9E, 0x22, 0xE8, 0x01, 0x80, 0xF7, 0x12, 0x59, 0xFE, 0x70, 0xD2,
+    0xCE, 0x00, 0xF9, 0xBA, 0x02, 0x9E, 0x00, 0xD6, 0xDA, 0xFE, 0x62, 0x6A, 0xFF, 0x12, 0x06, 0x02,
+    0x82, 0xF5, 0xC9, 0xFD, 0x89, 0x09, 0x22, 0xE6, 0x2D, 0x01, 0xF1, 0xDE, 0x21, 0x68, 0xB2, 0x00,
+    0xFF, 0x79, 0x53, 0x22, 0x72, 0x01, 0x81, 0xF6, 0xC9, 0xF6, 0x0E, 0xFE, 0x52, 0xFC, 0x00, 0xD1,
+    0x68, 0x31, 0x98, 0xEA, 0x8B, 0x00, 0x5E, 0x08, 0x00, 0x1F, 0xFF, 0x1E, 0x04, 0x00, 0x0D, 0x02,
+    0x8E, 0xF7, 0x04, 0x00, 0x85, 0x00, 0x12, 0xFA, 0xFD, 0x72, 0xA0, 0x01, 0xA2, 0x4A, 0xFF, 0xE2,
+    0xDD, 0xFE, 0xE1, 0x8F, 0x61, 0x71, 0x32, 0x9C, 0x01, 0x86, 0xF6, 0xBC, 0xFD, 0x82, 0x0B, 0x80,
+    0x00, 0xFA, 0xC4, 0x01, 0x92, 0x64, 0xFE, 0x52, 0xAD, 0x00, 0xE0, 0x26, 0x8A, 0x00, 0xC2, 0x38,
+    0x01, 0x02, 0xDC, 0xFD, 0x8A, 0x09, 0x7C, 0xFF, 0x02, 0x90, 0x02, 0x82, 0xF6, 0xA9, 0xFD, 0x71,
+    0x74, 0xE2, 0xAF, 0x00, 0x16, 0x28, 0xFF, 0x02, 0x29, 0x01, 0x82, 0xF8, 0x2C, 0xFE, 0x82, 0x09,
+    0x12, 0x02, 0x80, 0xF7, 0x8A, 0x08, 0xA6, 0xFD, 0x06, 0x1C, 0x02, 0xA1, 0x3E, 0x42, 0x4A, 0xFF,
+    0xF1, 0xC5, 0x3A, 0x3F, 0xFF, 0x26, 0xF0, 0x01, 0x82, 0xF5, 0x78, 0xFD, 0x81, 0x09, 0x38, 0x22,
+    0x50, 0x02, 0x8A, 0xF8, 0x10, 0xFE, 0x51, 0x39, 0xBD, 0x02, 0x00, 0xD8, 0x32, 0xC3, 0x00, 0xB9,
+    0x63, 0x72, 0xA1, 0xFE, 0x3A, 0x01, 0x02, 0x86, 0xF5, 0x5E, 0xFF, 0x82, 0x08, 0x21, 0xFE, 0xF2,
+    0xA4, 0x01, 0xA2, 0xB5, 0xFE, 0x22, 0xD6, 0x00, 0x20, 0x3A, 0x9C, 0x00, 0x82, 0xF8, 0xB6, 0x00,
+    0x22, 0xEE, 0xFD, 0x86, 0x08, 0xAD, 0x01, 0x80, 0xF6, 0x32, 0x9D, 0xFE, 0x32, 0xB0, 0x00, 0xDA,
+    0x06, 0xFF, 0x36, 0xFA, 0x00, 0xBA, 0xCE, 0xFE, 0x85, 0x09, 0xA3, 0xF2, 0x42, 0x02, 0x82, 0xF7,
+    0xF4, 0xFD, 0x89, 0x0B, 0x27, 0xB2, 0x1E, 0x01, 0xF1, 0xC7, 0x26, 0x88, 0x00, 0xF2, 0x36, 0xFE,
+    0x12, 0xCA, 0x01, 0x9A, 0xA0, 0x00, 0x82, 0x0A, 0x86, 0xFD, 0xE2, 0x01, 0x02, 0x82, 0xF7, 0xFF,
+    0xFD, 0x82, 0x08, 0xA5, 0x00, 0xC1, 0x39, 0x00, 0xD2, 0xE8, 0x00, 0x62, 0x05, 0xFE, 0x36, 0x72,
+    0x02, 0x82, 0xF6, 0xD3, 0xFD, 0x82, 0x0B, 0x80, 0x02, 0x81, 0xF5, 0x85, 0x2A, 0x69, 0xFE, 0x52,
+    0x0D, 0x01, 0xE6, 0x53, 0xFF, 0x32, 0xFC, 0x00, 0xA2, 0xA4, 0xFE, 0x72, 0x5C, 0xFF, 0x86, 0xF6,
+    0xB6, 0x02, 0x2A, 0xB6, 0xFD, 0x82, 0x08, 0xCF, 0x01, 0x85, 0xF8, 0x8A, 0x0A, 0xA7, 0xFE, 0xD2,
+    0x60, 0xFF, 0xF1, 0xCC, 0xE9, 0x99, 0x02, 0x8C, 0x00, 0x31, 0xCC, 0xF0, 0x05, 0x77, 0x2E, 0xFA,
+    0xFF, 0x57, 0xFF, 0x1D, 0xF2, 0xFF, 0xC0, 0x0E, 0xE7, 0xFF, 0x5C, 0xFF, 0x6D, 0xFB, 0xFF, 0x36,
+    0x2D, 0xFB, 0xFF, 0x57, 0xE1, 0xA4, 0x39, 0x4A, 0x01, 0x1C, 0x00, 0xF0, 0x1D, 0xFB, 0xFF, 0xAC,
+    0x0D, 0xFD, 0xFF, 0x08, 0xED, 0xFE, 0xFF, 0x34, 0x25, 0xC2, 0x21, 0x48, 0x05, 0x7A, 0x30, 0xF9,
+    0xF6, 0xF5, 0xB5, 0x21, 0x0A, 0x01, 0x4B, 0xE0, 0x09, 0xB5, 0x11, 0xD1, 0xF1, 0x25, 0x15, 0x2F,
+    0x21, 0x4D, 0xE0, 0x11, 0xD9, 0x19, 0xD0, 0x01, 0x4C, 0xF0, 0x10, 0xF5, 0x0B, 0xF1, 0xB3, 0x19,
+    0xB6, 0x01, 0x66, 0xF0, 0xE1, 0x90, 0x15, 0x2F, 0xF1, 0xDB, 0x10, 0x11, 0x4A, 0xE0, 0xF1, 0x92,
+    0x39, 0x6E, 0xF5, 0xB6, 0xD1, 0xB8, 0x01, 0x48, 0xF1, 0x94, 0x11, 0x24, 0xD1, 0x3E, 0x31, 0xC2,
+    0x11, 0xDC, 0x01, 0x48, 0xF1, 0xDC, 0x08, 0xF1, 0xD3, 0x41, 0x23, 0x05, 0x77, 0xE1, 0x25, 0x21,
+    0xDB, 0x09, 0xF6, 0xF1, 0xDB, 0x11, 0x25, 0x05, 0x55, 0xF1, 0x90, 0x30, 0xF1, 0x4A, 0xE0, 0x19,
+    0xD1, 0x11, 0x4B, 0x10, 0x05, 0xBF, 0x01, 0x4B, 0xE8, 0x11, 0xD0, 0x10, 0x05, 0x30, 0x01, 0xDA,
+    0x01, 0x26, 0xF1, 0x27, 0x09, 0xA9, 0x21, 0x26, 0x10, 0xF5, 0x31, 0xF1, 0xB3, 0x01, 0x26, 0xE0,
+    0x01, 0xB5, 0x49, 0x41, 0xF5, 0x31, 0xE1, 0xD9, 0x10, 0x01, 0x27, 0xF9, 0xA9, 0x30, 0xE1, 0x26,
+    0xE0, 0x01, 0xB5, 0x24, 0x01, 0x55, 0x19, 0xF6, 0x11, 0x4D, 0xE5, 0x26, 0x01, 0x97, 0x24, 0x01,
+    0x5A, 0xF9, 0xA6, 0xF0, 0x09, 0x69, 0x25, 0x26, 0x11, 0xE5, 0x10, 0x21, 0x75, 0xE1, 0xCD, 0x11,
+    0xE5, 0xF9, 0xF4, 0xE5, 0x0C, 0x11, 0xD9, 0x01, 0x8C, 0x09, 0x69, 0x00, 0x00, 0x11, 0x26, 0xF0,
+    0x05, 0xE5, 0x20, 0x11, 0x27, 0xF1, 0x27, 0xF9, 0xCD, 0x05, 0x0C, 0x01, 0x27, 0xF0, 0x01, 0xB2,
+    0x10, 0x01, 0x27, 0xF0, 0x05, 0xB3, 0x01, 0x32, 0xF1, 0x27, 0x19, 0xCD, 0x20, 0xE0, 0xF0, 0x10,
+    0xE0, 0x01, 0x75, 0x21, 0x8B, 0x19, 0x27, 0xE1, 0x1B, 0x25, 0xD9, 0x11, 0x0C, 0xE0, 0x09, 0xD9,
+    0x41, 0x1B, 0xF1, 0x4E, 0xE5, 0x0C, 0x10, 0x01, 0xD9, 0x01, 0x50, 0x11, 0xD7, 0x11, 0x29, 0x41,
+    0x51, 0x01, 0x29, 0x11, 0x55, 0x00, 0x00, 0x21, 0x53, 0xE9, 0xF1, 0x01, 0x2A, 0x15, 0xD6, 0x01,
+    0xE5, 0x00, 0x01, 0x54, 0x10, 0x09, 0xF1, 0xF1, 0xD6, 0x05, 0xE5, 0x00, 0xF0, 0xF9, 0x1B, 0x01,
+    0x2A, 0x25, 0xBB, 0x00, 0x21, 0x7F, 0x11, 0x56, 0x11, 0x2C, 0x00, 0x00, 0x01, 0xD4, 0x01, 0xD5,
+    0x00, 0x11, 0x2B, 0xE0, 0x00, 0x00, 0x11, 0xD5, 0x00, 0x10, 0x01, 0xD5, 0x01, 0x56, 0x00, 0x00,
+    0xF1, 0xD5, 0x01, 0xD5, 0x11, 0xD5, 0x01, 0x2B, 0x01, 0x56, 0x00, 0x00, 0x01, 0xD5, 0x01, 0xD5,
+    0x05, 0x10, 0xF9, 0xC5, 0x01, 0x2B, 0xF0, 0xF1, 0xD5, 0x10, 0x10, 0x00, 0x01, 0x56, 0x00, 0x01,
+    0x57, 0x11, 0xD4, 0xF1, 0xD5, 0xE1, 0xAA, 0x20, 0x01, 0x2B, 0xF0, 0xF1, 0x56, 0x10, 0xF1, 0xD5,
+    0x01, 0xAA, 0x11, 0x2B, 0xF1, 0xAB, 0xF1, 0x55, 0x11, 0x2B, 0xF1, 0xD5, 0x00, 0x11, 0xD5, 0x19,
+    0x2B, 0xF1, 0x46, 0x24, 0xF5, 0x21, 0x19, 0xEF, 0x00, 0x19, 0xC5, 0x11, 0x2B, 0x05, 0x2C, 0x01,
+    0x10, 0xE1, 0xA9, 0xD2, 0xAF, 0xFE, 0x8A, 0xF6, 0x38, 0xFF, 0xB2, 0x5D, 0xFE, 0x82, 0xF4, 0x37,
+    0xFF, 0xB2, 0x65, 0xFF, 0xA2, 0x51, 0xFF, 0xF2, 0x66, 0xFF, 0xB0, 0x82, 0xF8, 0x54, 0xFF, 0x00,
+    0x00, 0x00, 0x86, 0x0B, 0xF7, 0x00, 0x82, 0x09, 0x04, 0x01, 0x5A, 0x67, 0x01, 0x71, 0x1A, 0x52,
+    0x90, 0x00, 0x42, 0xBE, 0x00, 0xE5, 0x59, 0x31, 0x27, 0x20, 0x11, 0x29, 0xF9, 0xCB, 0xE1, 0xB2,
+    0x25, 0xE5, 0xE1, 0x27, 0xE1, 0x8C, 0xD1, 0xB3, 0x09, 0x1C, 0xF5, 0xB5, 0x11, 0xE5, 0x11, 0x70,
+    0xE0, 0x01, 0xB5, 0x29, 0x1B, 0x01, 0x26, 0xF1, 0xDA, 0x25, 0x4C, 0xE1, 0x0B, 0xF1, 0x99, 0x31,
+    0x40, 0xF0, 0xF9, 0xF6, 0x25, 0x26, 0xF1, 0xE4, 0xE1, 0xB5, 0x31, 0x25, 0x22, 0x9A, 0x00, 0xD0,
+    0x21, 0xDA, 0xF1, 0x8C, 0xF1, 0x26, 0x30, 0xD0, 0xE1, 0x27, 0x11, 0xB3, 0x11, 0xDB, 0x11, 0x72,
+    0x01, 0xD9, 0xE1, 0xDA, 0xF9, 0x26, 0xF1, 0x86, 0x02, 0x72, 0xFF, 0xF5, 0x74, 0xE1, 0xDC, 0x10,
+    0x00, 0x31, 0x48, 0x11, 0x4A, 0xD1, 0x26, 0x11, 0x90, 0x10, 0x01, 0x25, 0xF1, 0x93, 0xE1, 0xDC,
+    0xE1, 0xDD, 0x42, 0x8F, 0x00, 0x31, 0x70, 0xE0, 0x01, 0xB5, 0x10, 0x11, 0x4B, 0x00, 0x00, 0xE1,
+    0x27, 0x01, 0x8E, 0x00, 0xF1, 0x4B, 0x11, 0xB5, 0x00, 0x00, 0x21, 0x4B, 0xE1, 0x90, 0xD1, 0xB8,
+    0x31, 0x24, 0x01, 0x3F, 0xD1, 0x0A, 0x41, 0x25, 0xE1, 0xB6, 0x00, 0x31, 0x4A, 0x21, 0x74, 0xE1,
+    0xD9, 0x01, 0xD9, 0x05, 0x0C, 0x01, 0xF4, 0x18, 0x21, 0x74, 0xD0, 0x01, 0x8C, 0x21, 0xDA, 0xE1,
+    0x26, 0xF1, 0xB5, 0xF8, 0xF1, 0xD1, 0xF5, 0xE6, 0x31, 0x0A, 0xF1, 0x3F, 0xE1, 0xB7, 0x31, 0x49,
+    0xF8, 0x01, 0xF6, 0x21, 0x4B, 0xE5, 0x0A, 0x11, 0xDA, 0x30, 0xF1, 0x4D, 0xF1, 0x27, 0x20, 0xF0,
+    0x01, 0x26, 0xF1, 0x8C, 0x21, 0xDA, 0xD1, 0x26, 0xE9, 0x86, 0x11, 0x25, 0xF5, 0xE5, 0x00, 0xF1,
+    0x25, 0x11, 0xDB, 0x39, 0x1B, 0x22, 0x98, 0x00, 0xE5, 0xD9, 0xF5, 0xC9, 0x19, 0x42, 0x01, 0xD9,
+    0x20, 0x01, 0x4E, 0xE0, 0x01, 0xB2, 0x10, 0xF0, 0x01, 0x27, 0x62, 0xC2, 0x00, 0x02, 0xCD, 0x00,
+    0x21, 0xAD, 0xF1, 0xAF, 0x15, 0xE4, 0xDD, 0x1E, 0x00, 0x2D, 0x9D, 0x09, 0x00, 0x77, 0xDD, 0x08,
+    0x00, 0xC3, 0xDE, 0x02, 0x00, 0x9E, 0x01, 0x36, 0xB8, 0xFE, 0xF1, 0x11, 0xC6, 0xFD, 0xFE, 0x8A,
+    0x08, 0xA5, 0x01, 0x81, 0xF6, 0xC9, 0xE2, 0xCD, 0xFD, 0x8A, 0x08, 0x82, 0x01, 0xB5, 0xDD, 0x21,
+    0x99, 0xE1, 0x9B, 0x41, 0x65, 0x5A, 0x60, 0x01, 0x82, 0xF7, 0x2C, 0xFE, 0x80, 0x09, 0x06, 0xE6,
+    0x01, 0x92, 0x8E, 0xFE, 0x51, 0x34, 0xD1, 0x33, 0x31, 0xCD, 0x22, 0x3E, 0x01, 0x92, 0x8E, 0xFE,
+    0x84, 0x0A, 0xC2, 0x4E, 0x01, 0x82, 0xF7, 0x28, 0xFE, 0x8A, 0x09, 0xF1, 0x00, 0xC0, 0x12, 0x66,
+    0xFF, 0xC2, 0x6E, 0x01, 0x12, 0xC5, 0xFE, 0x81, 0x09, 0xCD, 0xF2, 0xDC, 0x01, 0x81, 0xF8, 0xC9,
+    0x72, 0xC2, 0xFE, 0xA1, 0x33, 0x10, 0xF2, 0xD4, 0x00, 0x52, 0x92, 0xFE, 0x22, 0xDC, 0x01, 0x92,
+    0xE4, 0x00, 0xFA, 0x73, 0xFD, 0x72, 0x2A, 0x01, 0x86, 0xF8, 0x71, 0xFF, 0x21, 0x99, 0x21, 0x67,
+    0x02, 0x00, 0xFF, 0x32, 0xA0, 0x01, 0x91, 0x6E, 0x82, 0x09, 0x24, 0xFE, 0x12, 0x15, 0x02, 0x82,
+    0xF7, 0x59, 0xFF, 0x32, 0x60, 0xFF, 0x11, 0x35, 0x02, 0x30, 0xFF, 0x32, 0x72, 0x01, 0x91, 0x37,
+    0x72, 0xC0, 0xFD, 0xF2, 0xD2, 0x01, 0x80, 0xF8, 0x32, 0xF9, 0xFE, 0x32, 0x9C, 0x00, 0xF1, 0x97,
+    0x46, 0x1E, 0x01, 0xA2, 0xAA, 0x00, 0xF2, 0xE0, 0xFD, 0x8A, 0x09, 0xD3, 0x01, 0x80, 0xF7, 0x32,
+    0xB9, 0xFE, 0x41, 0x35, 0xC1, 0xCB, 0x35, 0x6A, 0xA9, 0x6D, 0x02, 0x8E, 0xFE, 0x80, 0x0B, 0xC2,
+    0x72, 0x01, 0xA1, 0x37, 0x32, 0x27, 0xFF, 0x00, 0x31, 0xBA, 0x2A, 0x45, 0x01, 0x84, 0xF8, 0xE2,
+    0xFE, 0xFD, 0x82, 0x09, 0xDC, 0x01, 0x90, 0x22, 0xF2, 0xFE, 0x22, 0xA0, 0x00, 0xD2, 0x2C, 0xFF,
+    0x41, 0x69, 0x92, 0x4B, 0x01, 0x12, 0xE5, 0xFD, 0x81, 0x09, 0xCD, 0xDA, 0x5D, 0x01, 0xB2, 0xFB,
+    0xFE, 0x35, 0x76, 0xF0, 0x42, 0xB3, 0x00, 0x11, 0x5B, 0x82, 0xF8, 0x57, 0xFE, 0x81, 0x0C, 0x67,
+    0xF2, 0xEE, 0x01, 0x82, 0xF8, 0x1D, 0xFF, 0x12, 0x5E, 0xFF, 0x22, 0xD9, 0x00, 0x15, 0xC9, 0x3E,
+    0x05, 0x00, 0xEF, 0x00, 0x2E, 0x04, 0x00, 0x03, 0x01, 0x82, 0xF3, 0x11, 0xFD, 0x8D, 0x09, 0x02,
+    0x00, 0x4B, 0xF6, 0xCA, 0x01, 0xA2, 0x97, 0xFE, 0x32, 0xB0, 0x00, 0xF1, 0xC5, 0x42, 0x15, 0xFF,
+    0x0A, 0xC8, 0x01, 0x82, 0xF8, 0x27, 0xFE, 0x82, 0x0B, 0xAD, 0x00, 0xF6, 0xC2, 0x01, 0x8A, 0xF8,
+    0x2D, 0xFF, 0x31, 0x87, 0xF1, 0xC5, 0x42, 0x18, 0xFF, 0x16, 0x30, 0x02, 0x82, 0xF8, 0xC2, 0x00,
+    0x2A, 0xBB, 0xFD, 0x80, 0x08, 0xD2, 0x2C, 0x01, 0xD2, 0x4A, 0xFF, 0x05, 0x14, 0xD2, 0x50, 0xFF,
+    0x61, 0x8A, 0x1A, 0x07, 0x02, 0x81, 0xF8, 0x3F, 0x86, 0x09, 0xBA, 0xFD, 0xC2, 0x63, 0x01, 0xA1,
+    0xC3, 0x50, 0xF2, 0xB9, 0x00, 0x3A, 0x0C, 0xFF, 0x52, 0xDD, 0x01, 0x82, 0xF5, 0xC3, 0xFE, 0x02,
+    0x9D, 0xFE, 0x85, 0x09, 0x4E, 0x82, 0xF8, 0xB0, 0x00, 0x0A, 0x3D, 0xFF, 0x52, 0x65, 0x01, 0xA2,
+    0x60, 0xFE, 0x52, 0x26, 0x01, 0xB2, 0x38, 0x01, 0xE2, 0x30, 0xFD, 0x75, 0x11, 0x12, 0xDA, 0x01,
+    0xD2, 0x4A, 0xFF, 0x09, 0x27, 0x01, 0xC5, 0x62, 0x51, 0xFF, 0xE2, 0xA0, 0x01, 0x82, 0xF8, 0x27,
+    0xFE, 0x81, 0x09, 0x39, 0xFA, 0x8A, 0x01, 0xC1, 0xC2, 0x35, 0xDA, 0xC6, 0x62, 0xFF, 0x61, 0xC6,
+    0x0A, 0xA9, 0x01, 0x82, 0xF7, 0xD0, 0xFD, 0x81, 0x0A, 0x39, 0xE2, 0xA0, 0x01, 0x92, 0x0F, 0xFF,
+    0x30, 0x00, 0x22, 0xDF, 0xFE, 0x12, 0xD5, 0x01, 0x92, 0x64, 0xFE, 0x85, 0x0A, 0x39, 0xF2, 0xF7,
+    0x01, 0x81, 0xF8, 0xC0, 0x62, 0x47, 0xFF, 0xE9, 0xEC, 0x11, 0x8A, 0x46, 0xAA, 0x01, 0x82, 0xF6,
+    0xBA, 0xFD, 0x72, 0xEB, 0xFE, 0xF2, 0x78, 0x02, 0x9A, 0x64, 0xFE, 0x62, 0x4A, 0xFF, 0x82, 0xF7,
+    0xA5, 0x00, 0x11, 0x91, 0xA6, 0xD5, 0xFE, 0x3A, 0x8C, 0x00, 0xD2, 0x66, 0xFF, 0x82, 0x09, 0xE1,
+    0x01, 0x82, 0xEA, 0xD2, 0xFB, 0x52, 0xD2, 0x00, 0xC2, 0x56, 0xFF, 0x86, 0x0B, 0xFF, 0x01, 0xE1,
+    0x9D, 0x5A, 0xFE, 0x00, 0xD2, 0x58, 0xFF, 0x4A, 0xCD, 0x00, 0xCE, 0xFB, 0xFF, 0xE5, 0xFE, 0x3D,
+    0xF8, 0xFF, 0x50, 0xDE, 0xF9, 0xFF, 0x0D, 0xFF, 0x0D, 0xEA, 0xFF, 0xE5, 0x2D, 0xFB, 0xFF, 0xF2,
+    0x6D, 0xFC, 0xFF, 0x5C, 0x01, 0xF0, 0x52, 0x94, 0x00, 0x32, 0x97, 0x00, 0xD1, 0x8D, 0x31, 0x4C,
+    0x01, 0x27, 0xF9, 0xD0, 0xF1, 0xDA, 0xF5, 0xE3, 0x21, 0xB5, 0xB1, 0xDC, 0xDE, 0xEE, 0xFF, 0x58,
+    0xFF, 0x3D, 0xF6, 0xFF, 0xC9, 0xED, 0xF6, 0xFF, 0xD2, 0x29, 0xE2, 0x3D, 0xFE, 0xFF, 0x4C, 0x41,
+    0x6B, 0x41, 0x76, 0x01, 0x7B, 0x3A, 0x81, 0x00, 0x51, 0xF6, 0x21, 0x42, 0x11, 0x22, 0xF1, 0xDE,
+    0xE1, 0xBE, 0x11, 0xE0, 0x00, 0x01, 0x41, 0x00, 0x01, 0xDF, 0x01, 0xE0, 0x11, 0x62, 0xF1, 0xDF,
+    0xE0, 0x11, 0xDF, 0x00, 0x11, 0x42, 0x01, 0xDF, 0xE1, 0xBF, 0x21, 0x41, 0x20, 0xF5, 0x2B, 0x00,
+    0xF9, 0xD5, 0x11, 0xDF, 0xF1, 0xE0, 0x11, 0x62, 0xF1, 0xDF, 0xD5, 0xC8, 0x21, 0x21, 0x09, 0xF6,
+    0xE1, 0x21, 0x11, 0x21, 0x11, 0xBE, 0x11, 0x21, 0x04, 0xF1, 0x09, 0xF9, 0xB6, 0x31, 0x20, 0x21,
+    0x42, 0xE0, 0x00, 0x01, 0xDF, 0x01, 0xDF, 0x01, 0x42, 0x00, 0xF1, 0x22, 0x05, 0xE8, 0x10, 0x00,
+    0x09, 0xF6, 0xF1, 0x22, 0x11, 0xD3, 0xE1, 0xC9, 0x11, 0xE0, 0xE1, 0xE0, 0xE1, 0xE0, 0x10, 0x09,
+    0xF6, 0x05, 0x20, 0xF1, 0x0A, 0x01, 0xE0, 0x11, 0x20, 0x11, 0x61, 0x10, 0xF1, 0xBF, 0x11, 0xC0,
+    0xF1, 0x40, 0x01, 0xE0, 0xE5, 0xE9, 0x29, 0x40, 0xF1, 0x17, 0x01, 0xC0, 0x11, 0x20, 0x31, 0x41,
+    0x00, 0xF0, 0x09, 0xF6, 0x10, 0x10, 0x05, 0x4D, 0xF1, 0xDE, 0xF0, 0x11, 0xDF, 0x21, 0x62, 0x00,
+    0xE0, 0x10, 0x01, 0xE1, 0x21, 0x40, 0x11, 0x22, 0xF9, 0xF4, 0xF1, 0xDF, 0x05, 0x0B, 0xF1, 0xC0,
+    0x11, 0x1F, 0xF0, 0x01, 0x21, 0x00, 0x01, 0xC0, 0x21, 0x40, 0x00, 0xF0, 0x00, 0xF1, 0xC0, 0x21,
+    0x40, 0x10, 0x01, 0x22, 0x11, 0x43, 0x01, 0xDE, 0xF1, 0xDF, 0xF1, 0xDE, 0x10, 0xF1, 0xDF, 0xF0,
+    0xF1, 0xE1, 0x11, 0x1F, 0x20, 0x11, 0x43, 0x01, 0x21, 0x01, 0xDF, 0xF5, 0x2D, 0xF1, 0xBD, 0x09,
+    0xF4, 0x21, 0x22, 0x00, 0xF0, 0xF0, 0x01, 0xDE, 0x11, 0x22, 0x10, 0x11, 0x21, 0x01, 0x22, 0xF0,
+    0xF1, 0xDE, 0xF1, 0xBD, 0x11, 0x22, 0x19, 0xDE, 0xF1, 0x16, 0xF5, 0xDF, 0xF1, 0x2D, 0xF1, 0x9E,
+    0x00, 0x21, 0x1F, 0x01, 0x21, 0x01, 0x22, 0x01, 0xDE, 0xF1, 0xDF, 0x31, 0x21, 0xF0, 0x09, 0x16,
+    0x00, 0xF5, 0xDF, 0x01, 0x0B, 0x10, 0x21, 0x22, 0xF0, 0x01, 0x21, 0xF1, 0xDF, 0xF1, 0xDE, 0x00,
+    0x20, 0x19, 0x43, 0xF1, 0xD3, 0xF1, 0x22, 0xF1, 0xBD, 0xF5, 0xEA, 0x11, 0x21, 0x20, 0xF1, 0x22,
+    0xF0, 0x01, 0x21, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x22, 0x01, 0xBD, 0x00, 0x20, 0xF0,
+    0xF0, 0xF1, 0xE1, 0x00, 0x20, 0x11, 0x40, 0x15, 0x2D, 0x01, 0x22, 0xF9, 0xD3, 0x00, 0x21, 0x21,
+    0x10, 0x01, 0x22, 0xF1, 0xDE, 0xF1, 0x22, 0xF1, 0xBD, 0xF1, 0xDE, 0x21, 0x22, 0x01, 0xDE, 0x01,
+    0x43, 0x01, 0x22, 0x01, 0x22, 0x01, 0xBC, 0x11, 0x22, 0x00, 0x11, 0x22, 0xF1, 0xDE, 0xF9, 0x22,
+    0x01, 0xD3, 0x00, 0xF4, 0x11, 0xE9, 0x00, 0x11, 0x22, 0xD1, 0xDE, 0xF0, 0x11, 0xB2, 0xF1, 0xEA,
+    0x11, 0x21, 0xE1, 0xDF, 0xF0, 0x01, 0xBF, 0x11, 0x22, 0x11, 0x1F, 0x00, 0xE0, 0x01, 0xBF, 0x21,
+    0xDF, 0x01, 0x21, 0x00, 0xF1, 0x22, 0x21, 0x40, 0x11, 0xDF, 0x10, 0xF1, 0xE1, 0xF1, 0x40, 0x11,
+    0x22, 0x15, 0x21, 0x11, 0x0C, 0x09, 0xD3, 0x01, 0xDE, 0xE1, 0xDF, 0xF1, 0x21, 0xF1, 0xDF, 0x10,
+    0x01, 0x21, 0x00, 0xE0, 0x10, 0xF1, 0xDF, 0x21, 0x21, 0xF0, 0xF0, 0x11, 0x22, 0x01, 0xDE, 0x10,
+    0x00, 0x11, 0x22, 0xE0, 0x01, 0x43, 0x32, 0xF7, 0xFE, 0xB1, 0x42, 0x00, 0xA1, 0xBE, 0x31, 0xE0,
+    0xF1, 0xE9, 0x02, 0x9B, 0x00, 0x10, 0xE2, 0x3C, 0xFF, 0x81, 0x08, 0x40, 0xF1, 0x20, 0x01, 0x64,
+    0xE1, 0xDE, 0x21, 0xDF, 0x31, 0x16, 0x01, 0xC9, 0xF2, 0xC6, 0x00, 0xE1, 0xBD, 0xD1, 0x9E, 0x20,
+    0xFE, 0x03, 0x00, 0x56, 0xFF, 0xDE, 0x1A, 0x00, 0xC0, 0x01, 0x8D, 0xF8, 0x1B, 0x00, 0x2E, 0xDD,
+    0x05, 0x00, 0x8F, 0x6E, 0x04, 0x00, 0xB6, 0x00, 0xDD, 0x02, 0x00, 0x1D, 0x02, 0x7D, 0xFF, 0x42,
+    0x58, 0x01, 0x91, 0x65, 0xF2, 0x14, 0xFE, 0x70, 0xE2, 0xF2, 0x00, 0xC1, 0xCF, 0x41, 0x31, 0xD0,
+    0xD2, 0xDF, 0xFE, 0x81, 0x09, 0x2F, 0x02, 0x87, 0x01, 0x80, 0xF8, 0x32, 0x09, 0xFF, 0x21, 0x31,
+    0xD1, 0x9E, 0x50, 0x16, 0x28, 0x01, 0x81, 0xF8, 0x76, 0x2A, 0x62, 0xFE, 0x60, 0xF2, 0xF7, 0x00,
+    0xF1, 0x9C, 0x11, 0x64, 0xD2, 0xCA, 0x00, 0xF2, 0x70, 0xFE, 0x71, 0xCF, 0x02, 0x8D, 0x01, 0xA2,
+    0x6A, 0xFF, 0xE2, 0x09, 0xFF, 0x22, 0xC6, 0x00, 0x01, 0x9C, 0x3E, 0xFB, 0xFF, 0xD1, 0xFE, 0x1E,
+    0xF7, 0xFF, 0x46, 0x01, 0xAD, 0xFE, 0xFF, 0xB4, 0xFE, 0xFE, 0xFF, 0xC5, 0xFE, 0x41, 0x20, 0xE1,
+    0x2A, 0x01, 0xAC, 0x32, 0xD7, 0x00, 0xA1, 0x56, 0x02, 0xAA, 0xFE, 0x61, 0xD8, 0x02, 0x28, 0x01,
+    0xD1, 0xD4, 0x31, 0x2C, 0xF2, 0xAF, 0x00, 0x02, 0x25, 0xFF, 0x59, 0x9E, 0xE2, 0xD8, 0x00, 0x21,
+    0x58, 0xB2, 0x88, 0x00, 0x55, 0x85, 0x21, 0x5B, 0xD9, 0x4E, 0xF2, 0xF2, 0xFE, 0x00, 0x61, 0xD5,
+    0xF2, 0xDD, 0x00, 0xD1, 0xB3, 0x01, 0x9B, 0x32, 0xE0, 0x00, 0xC1, 0x5E, 0xE5, 0xDE, 0xF2, 0x9A,
+    0xFE, 0x62, 0x83, 0x00, 0x11, 0x2C, 0x9A, 0x51, 0xFF, 0x31, 0xC8, 0x22, 0x07, 0x01, 0xA1, 0x2D,
+    0x00, 0x22, 0x23, 0xFF, 0x10, 0xF0, 0x35, 0xD5, 0x12, 0xBB, 0x00, 0x22, 0x88, 0x00, 0x81, 0xF8,
+    0xD3, 0x12, 0xF6, 0xFE, 0x41, 0x2A, 0xD0, 0xD2, 0x7E, 0xFF, 0x61, 0xD5, 0xF2, 0x06, 0x01, 0xA1,
+    0x59, 0x12, 0xCC, 0xFE, 0x30, 0x0A, 0x82, 0x00, 0x11, 0x20, 0x46, 0x7E, 0xFF, 0xF2, 0x14, 0x01,
+    0x99, 0x2E, 0x02, 0x93, 0xFE, 0x41, 0x2B, 0x02, 0x82, 0x00, 0xF5, 0xD5, 0x31, 0xB5, 0x12, 0x08,
+    0x01, 0x90, 0xEA, 0x6D, 0xFE, 0x31, 0xD6, 0x26, 0x00, 0x01, 0x62, 0x18, 0x01, 0xE1, 0x5F, 0x40,
+    0xF9, 0xC2, 0x11, 0x30, 0xE1, 0xD0, 0xE2, 0x77, 0xFF, 0x05, 0x0D, 0x31, 0x2E, 0x01, 0x5C, 0x00,
+    0xF9, 0xC4, 0x24, 0x01, 0x6C, 0x00, 0xE0, 0xF9, 0xA1, 0x11, 0xF3, 0x00, 0xF1, 0x5E, 0x05, 0xDE,
+    0x01, 0xA4, 0x19, 0xF2, 0xF5, 0x0E, 0xF1, 0xD2, 0x11, 0xF3, 0x11, 0x0D, 0x22, 0xBA, 0x00, 0x00,
+    0xE0, 0x11, 0xD0, 0x08, 0x01, 0x22, 0xF5, 0x0E, 0x01, 0xA1, 0x08, 0x21, 0x21, 0x11, 0x5F, 0x01,
+    0x2E, 0xF5, 0xB1, 0x21, 0xD0, 0xF0, 0xF1, 0x30, 0xF1, 0xD0, 0x11, 0x30, 0x11, 0xD0, 0xF1, 0x30,
+    0x00, 0xE1, 0x30, 0x11, 0xD0, 0x19, 0xF2, 0x00, 0xB6, 0x4C, 0xFE, 0x82, 0xF4, 0xDB, 0xFE, 0xAA,
+    0x18, 0xFF, 0x92, 0x01, 0xFF, 0xA2, 0x3D, 0xFF, 0xC2, 0x08, 0xFF, 0xB0, 0x0D, 0xFA, 0xFF, 0xED,
+    0x4D, 0xE3, 0xFF, 0x32, 0x6D, 0xF3, 0xFF, 0x21, 0x6D, 0xF4, 0xFF, 0x66, 0x1E, 0xFE, 0xFF, 0x80,
+    0x00, 0x69, 0xE3, 0x52, 0x8F, 0x00, 0x05, 0x65, 0x31, 0xED, 0x31, 0x4F, 0x29, 0x2E, 0x21, 0x36,
+    0x31, 0x38, 0x15, 0x42, 0x31, 0x58, 0xF1, 0x3C, 0x30, 0x11, 0x5A, 0x29, 0x13, 0x01, 0x1E, 0x00,
+    0x05, 0xEE, 0xFD, 0x05, 0x00, 0xFB, 0xED, 0x0F, 0x00, 0x19, 0xFD, 0x03, 0x00, 0x71, 0x0D, 0x03,
+    0x00, 0x40, 0x05, 0x1D, 0x11, 0xDB, 0x00, 0x01, 0xEB, 0xF9, 0x15, 0x04, 0xF1, 0xB7, 0x21, 0x49,
+    0x05, 0x0F, 0x21, 0x24, 0xED, 0xFE, 0xFF, 0xCD, 0x01, 0x3B, 0x11, 0xDC, 0xF5, 0xE9, 0x35, 0x25,
+    0xF1, 0x0E, 0xF0, 0x01, 0x26, 0xF9, 0xA7, 0x00, 0xF1, 0xDD, 0x21, 0x48, 0x00, 0x01, 0x25, 0xF9,
+    0xA9, 0xF5, 0xDC, 0x21, 0x0E, 0xF5, 0xE8, 0x01, 0x4A, 0x00, 0x09, 0xF1, 0x20, 0x10, 0xF1, 0x25,
+    0x01, 0x25, 0xF1, 0xDB, 0x00, 0x01, 0xDB, 0x10, 0xF5, 0xEB, 0x09, 0x3A, 0x00, 0x01, 0xEA, 0x01,
+    0xF1, 0x01, 0xDD, 0x01, 0x48, 0x11, 0x25, 0xF0, 0x21, 0x24, 0x11, 0xDC, 0x00, 0xF1, 0x24, 0xF1,
+    0xDC, 0xE1, 0xB6, 0x00, 0x10, 0x01, 0x33, 0x19, 0x08, 0x11, 0x25, 0xE4, 0x21, 0x0E, 0x05, 0xC5,
+    0x01, 0x26, 0x19, 0x3B, 0xF1, 0xDA, 0xF0, 0x10, 0x15, 0x36, 0x01, 0xB5, 0x08, 0x09, 0x2C, 0xF1,
+    0xDB, 0xF5, 0xEA, 0x00, 0x20, 0x01, 0xDB, 0xF0, 0x01, 0x49, 0x11, 0x26, 0x05, 0x10, 0x00, 0x11,
+    0xDA, 0x09, 0xDB, 0xE1, 0x15, 0x09, 0x17, 0x05, 0xE9, 0xE1, 0xB7, 0xE5, 0xC6, 0x21, 0x24, 0x09,
+    0x24, 0x11, 0x17, 0x01, 0xDB, 0x00, 0x10, 0x01, 0x25, 0x05, 0x34, 0x09, 0xF0, 0x00, 0x15, 0xDC,
+    0xF1, 0xE9, 0x01, 0x26, 0x01, 0x25, 0x08, 0xF1, 0xCC, 0x00, 0x20, 0xF5, 0xB6, 0xE9, 0x25, 0xE0,
+    0x20, 0x21, 0x49, 0x21, 0x4C, 0x00, 0xE1, 0xB4, 0xD1, 0x92, 0xF1, 0xB7, 0xF0, 0xF1, 0x26, 0x01,
+    0xDA, 0xE1, 0xDC, 0x01, 0xB8, 0x01, 0xBA, 0xF1, 0x23, 0xF1, 0xDD, 0x01, 0xBB, 0x19, 0x39, 0x32,
+    0x8D, 0x00, 0xED, 0x02, 0x00, 0x31, 0x21, 0xEA, 0x08, 0x31, 0x5F, 0xE0, 0xF1, 0x25, 0x11, 0x92,
+    0xF1, 0xDC, 0x11, 0x24, 0x01, 0x26, 0x00, 0x01, 0xDA, 0x04, 0x31, 0x34, 0x01, 0x48, 0x29, 0x61,
+    0x08, 0x01, 0xCC, 0xF5, 0xDB, 0xFD, 0x0B, 0x00, 0xF8, 0x0E, 0x07, 0x00, 0xA4, 0x00, 0xDD, 0x06,
+    0x00, 0x0E, 0xF5, 0xFD, 0x00, 0x11, 0xD5, 0x05, 0xE1, 0xE1, 0x2C, 0xF1, 0x2C, 0x11, 0xA8, 0x01,
+    0x2C, 0x19, 0x1E, 0xD0, 0x05, 0xE2, 0x11, 0xD4, 0x10, 0xF1, 0x2C, 0xF1, 0xAA, 0x11, 0xAB, 0xE1,
+    0x2B, 0x00, 0xD1, 0xD5, 0x11, 0xE3, 0x01, 0x1D, 0x01, 0xD7, 0x11, 0x29, 0x41, 0x55, 0x05, 0x2A,
+    0x01, 0x39, 0xE9, 0xD5, 0x19, 0xBB, 0xE1, 0xD6, 0xF1, 0x55, 0x15, 0x38, 0x01, 0x80, 0x31, 0x62,
+    0xF1, 0xF2, 0x00, 0x00, 0x11, 0xD6, 0x16, 0x90, 0x00, 0x01, 0xF2, 0xE8, 0x20, 0x00, 0xF1, 0x59,
+    0x11, 0x2C, 0x00, 0x11, 0xA7, 0x10, 0xF0, 0xE1, 0xA8, 0xF1, 0xD4, 0x30, 0xE1, 0x2C, 0xF1, 0xD4,
+    0x00, 0x01, 0xD6, 0x01, 0x2A, 0xE5, 0x0E, 0x09, 0x2B, 0x11, 0x9D, 0x32, 0x82, 0x00, 0x01, 0xD4,
+    0xF1, 0x2C, 0x10, 0x11, 0xE1, 0x01, 0xF3, 0x01, 0x58, 0xF1, 0xD4, 0xF9, 0xF2, 0x11, 0xAA, 0x05,
+    0x64, 0xE0, 0x01, 0x2C, 0x02, 0x7C, 0xFF, 0x11, 0x2C, 0x09, 0x2C, 0x05, 0x2C, 0x01, 0xA8, 0xF5,
+    0xE2, 0x20, 0x09, 0xF2, 0xF1, 0x39, 0x11, 0xF3, 0x14, 0x12, 0x94, 0x00, 0xD1, 0xD2, 0x09, 0x1F,
+    0x11, 0xA7, 0xF1, 0xD4, 0x01, 0x2C, 0x01, 0x2C, 0xF2, 0x7C, 0xFF, 0xF1, 0xD6, 0x21, 0xD6, 0xE1,
+    0x2A, 0xF1, 0xD6, 0x05, 0xE2, 0x01, 0x2A, 0xE9, 0xF4, 0xF1, 0x2A, 0x31, 0xD6, 0x00, 0x11, 0x2A,
+    0x00, 0x45, 0x56, 0x11, 0x3A, 0x0D, 0xFE, 0xFF, 0x4B, 0xE1, 0xC5, 0x00, 0x01, 0xD4, 0x05, 0x0E,
+    0xE5, 0xA8, 0x01, 0x0E, 0x28, 0x19, 0x3C, 0x05, 0x3A, 0xF1, 0xD4, 0x11, 0xD4, 0xF1, 0xAA, 0xE1,
+    0x2A, 0xE1, 0xD6, 0x00, 0x10, 0xF1, 0x2A, 0x00, 0xE2, 0x58, 0xFF, 0x30, 0xF9, 0x47, 0x00, 0x15,
+    0x2A, 0x01, 0x0D, 0x15, 0x38, 0xE0, 0xEA, 0x4A, 0xFF, 0x49, 0x71, 0xF5, 0xD6, 0xF1, 0x0D, 0x20,
+    0xE0, 0x11, 0x2A, 0xE0, 0xF1, 0x82, 0x46, 0xA8, 0x00, 0xF1, 0xE3, 0x09, 0xC9, 0x00, 0x11, 0x54,
+    0xE0, 0x00, 0x01, 0xAC, 0x11, 0x2A, 0x05, 0x56, 0x11, 0xE2, 0xF9, 0xC8, 0x11, 0xAB, 0x05, 0x7F,
+    0xFE, 0x11, 0x00, 0xD1, 0x00, 0xEE, 0x1D, 0x00, 0xE5, 0x00, 0x6E, 0x06, 0x00, 0x24, 0x03, 0xAD,
+    0x04, 0x00, 0x18, 0x31, 0x65, 0x34, 0x01, 0x1F, 0xA1, 0xB9, 0xD2, 0xE2, 0xFD, 0x22, 0x83, 0x00,
+    0x82, 0x08, 0xCA, 0x00, 0xD2, 0x8A, 0x00, 0xD2, 0x31, 0xFF, 0x26, 0xB5, 0xFE, 0x0A, 0xD5, 0x01,
+    0x42, 0x1C, 0x01, 0x85, 0xF8, 0x8F, 0x1A, 0x89, 0xFE, 0x42, 0x87, 0x00, 0xD5, 0x62, 0x02, 0x76,
+    0xFF, 0xF1, 0xBC, 0x81, 0x08, 0x44, 0x02, 0xEF, 0x01, 0xDA, 0x0A, 0xFF, 0xC2, 0x74, 0xFF, 0x26,
+    0x76, 0xFF, 0x32, 0x7D, 0x01, 0xB2, 0x8F, 0x00, 0xE2, 0x71, 0xFF, 0x02, 0x19, 0xFE, 0x72, 0x87,
+    0x00, 0xEA, 0x8A, 0x00, 0xD2, 0x59, 0xFF, 0xD2, 0x39, 0xFF, 0x71, 0x42, 0xA2, 0x70, 0x02, 0x11,
+    0xBB, 0x21, 0x45, 0x22, 0xE4, 0xFE, 0x12, 0x8E, 0x00, 0xE0, 0xD6, 0x61, 0xFE, 0x19, 0x42, 0x85,
+    0x08, 0x1D, 0xD9, 0xE3, 0xE2, 0xCF, 0x00, 0xE6, 0x0A, 0xFF, 0x20, 0x22, 0xA4, 0x01, 0x22, 0x8F,
+    0x00, 0x90, 0x10, 0x42, 0x71, 0xFF, 0x11, 0x49, 0xE2, 0xD6, 0x00, 0xF0, 0xDA, 0x64, 0xFD, 0x60,
+    0xF0, 0xC1, 0x45, 0xF1, 0xBB, 0x46, 0x7B, 0xFF, 0x0A, 0x9B, 0x01, 0x91, 0x47, 0x21, 0x49, 0x22,
+    0x9F, 0xFE, 0x32, 0xD1, 0x00, 0xE5, 0x1F, 0xE2, 0xE8, 0xFE, 0xF9, 0xBC, 0x71, 0xE5, 0x01, 0x1B,
+    0xD6, 0x15, 0x01, 0xD2, 0x2F, 0xFF, 0x11, 0x45, 0x19, 0x45, 0xA1, 0x28, 0xFA, 0xCD, 0xFD, 0x15,
+    0x5C, 0x51, 0x41, 0xF6, 0xE4, 0x00, 0xF1, 0xBC, 0x39, 0xBD, 0x22, 0x80, 0x01, 0xA6, 0xB0, 0x00,
+    0xF2, 0xD0, 0xFD, 0x02, 0x85, 0xFC, 0x8A, 0xED, 0x9E, 0xFE, 0x92, 0x97, 0xFE, 0x02, 0xEC, 0xFE,
+    0xA0, 0x82, 0xF6, 0x78, 0xFE, 0x05, 0x05, 0x8A, 0xF8, 0xFE, 0xFE, 0x00, 0x01, 0xE6, 0xA2, 0x7F,
+    0xFF, 0xC1, 0xD1, 0xE5, 0xE7, 0xF1, 0xEC, 0xF1, 0xF7, 0xF9, 0xF9, 0xF0, 0xF1, 0xFB, 0x00, 0x04,
+    0x00, 0x08, 0x00, 0x00, 0x45, 0x1E, 0x00, 0x82, 0x19, 0x83, 0x02, 0x82, 0x0A, 0xFE, 0x05, 0x82,
+    0x0E, 0x97, 0xFE, 0x8A, 0x09, 0x10, 0x02, 0xB0, 0x26, 0x59, 0xFF, 0xC0, 0x31, 0xC3, 0x52, 0x3C,
+    0x01, 0x89, 0xF8, 0xBF, 0xF2, 0x01, 0xFE, 0x82, 0x08, 0xE8, 0x01, 0xA5, 0xD7, 0xF2, 0x7C, 0xFE,
+    0x22, 0x06, 0x01, 0x2A, 0xBF, 0xFE, 0xF2, 0xEF, 0x00, 0x92, 0x65, 0xFE, 0x81, 0x09, 0x91, 0xC2,
+    0x93, 0x01, 0x86, 0xF8, 0x38, 0xFE, 0x82, 0x09, 0x17, 0x02, 0x92, 0x66, 0xFE, 0x09, 0xB8, 0xD5,
+    0x96, 0x62, 0x5D, 0x01, 0x82, 0xF5, 0xAC, 0xFD, 0x82, 0x08, 0xA9, 0x01, 0x8A, 0xED, 0x5F, 0xFB,
+    0x82, 0xF1, 0x08, 0xFF, 0x02, 0xA9, 0x01, 0x85, 0x0D, 0x06, 0xA2, 0xA6, 0xFE, 0x82, 0xF5, 0x52,
+    0xFF, 0x02, 0x5B, 0x03, 0x82, 0x19, 0x7A, 0xFF, 0xDA, 0x6B, 0x02, 0x82, 0x0D, 0x2F, 0xFF, 0x16,
+    0x15, 0x01, 0xC2, 0x2C, 0xFF, 0x32, 0x9E, 0x00, 0xE9, 0x89, 0x32, 0x9E, 0x00, 0xF1, 0xCB, 0x09,
+    0x5B, 0x2D, 0x02, 0x00, 0x0F, 0x32, 0xB8, 0x00, 0xDA, 0x58, 0xFF, 0x41, 0x27, 0xD2, 0xE4, 0x00,
+    0x12, 0x54, 0xFF, 0x25, 0x72, 0xE1, 0xD7, 0x10, 0xF1, 0xC7, 0x29, 0x62, 0xD0, 0x32, 0xDB, 0xFE,
+    0xE6, 0xC3, 0x00, 0xDA, 0x5B, 0xFF, 0x21, 0x5D, 0xE1, 0x94, 0x11, 0x6C, 0x11, 0xC9, 0x11, 0x6F,
+    0xD2, 0x5C, 0xFF, 0x36, 0xB4, 0x00, 0xC2, 0x25, 0xFF, 0x42, 0xDB, 0x00, 0xCE, 0xEE, 0xFF, 0x53,
+    0xFF, 0x2E, 0xEC, 0xFF, 0x35, 0xFE, 0x3D, 0xED, 0xFF, 0x2B, 0x3D, 0xFD, 0xFF, 0x1D, 0x1D, 0xFB,
+    0xFF, 0x52, 0x29, 0xE4, 0x4D, 0xFC, 0xFF, 0x73, 0xF9, 0x35, 0x39, 0xF6, 0x39, 0x3F, 0x21, 0x6F,
+    0x21, 0x4C, 0x10, 0x19, 0x1A, 0x11, 0x4F, 0x00, 0xE4, 0x11, 0xE6, 0x00, 0x09, 0x4F, 0x01, 0xCB,
+    0xF1, 0xB1, 0x15, 0x35, 0x10, 0x01, 0x27, 0x00, 0xF1, 0xD9, 0x29, 0xF2, 0x01, 0xD9, 0x01, 0x76,
+    0xF5, 0xE6, 0x00, 0x19, 0x1A, 0xF1, 0xD9, 0xE0, 0x11, 0x27, 0xF1, 0x8A, 0x25, 0x5C, 0xF9, 0xCB,
+    0xF1, 0xD9, 0x31, 0x27, 0x01, 0xD9, 0x06, 0x84, 0x00, 0xF1, 0xD8, 0xF1, 0xD9, 0x10, 0x09, 0x1A,
+    0x00, 0xD0, 0x11, 0xB1, 0x11, 0x27, 0x05, 0x0E, 0xF8, 0xF1, 0xA5, 0x20, 0x15, 0x33, 0xF1, 0x28,
+    0x11, 0x27, 0x11, 0xD9, 0xF1, 0xD8, 0x19, 0x69, 0xE1, 0x29, 0x05, 0xB0, 0xF1, 0xBE, 0xF1, 0xD9,
+    0x08, 0xF1, 0xCE, 0xE1, 0xB5, 0x20, 0x26, 0x97, 0x00, 0x11, 0x35, 0x11, 0xF2, 0x01, 0xE6, 0x19,
+    0x69, 0xD0, 0x04, 0x11, 0xBF, 0x10, 0xF0, 0x18, 0x11, 0x1A, 0x21, 0x27, 0x05, 0x5F, 0xD8, 0x34,
+    0x09, 0xA1, 0x01, 0x50, 0xF1, 0xD9, 0xDD, 0x09, 0x00, 0x53, 0xFD, 0x1F, 0x00, 0x4C, 0xEE, 0x07,
+    0x00, 0x16, 0x01, 0xFD, 0x05, 0x00, 0x24, 0x96, 0xB1, 0xFE, 0x41, 0x6B, 0x01, 0x6E, 0x05, 0x92,
+    0x59, 0x6E, 0xF2, 0xD9, 0x00, 0x81, 0xF7, 0x92, 0x12, 0xBC, 0xFE, 0x60, 0xD2, 0xA1, 0x00, 0x02,
+    0x5F, 0xFF, 0xF5, 0x7E, 0xB2, 0xA5, 0x00, 0x12, 0x87, 0xFE, 0x89, 0x0A, 0x69, 0xE2, 0x31, 0x01,
+    0xC5, 0xCA, 0x11, 0xA7, 0xE1, 0x38, 0x02, 0x5B, 0xFF, 0x69, 0xB8, 0x32, 0xEB, 0x01, 0x11, 0x72,
+    0xA1, 0xC7, 0x26, 0x6D, 0xFF, 0x00, 0xC2, 0x24, 0xFF, 0xE1, 0x93, 0x88, 0x08, 0x02, 0xA3, 0x01,
+    0x91, 0xC7, 0x06, 0xB9, 0xFE, 0x11, 0x13, 0xF8, 0x41, 0x82, 0x11, 0xCC, 0x06, 0xC5, 0x01, 0x81,
+    0xF8, 0xC9, 0x22, 0xEE, 0xFE, 0x41, 0x36, 0xD0, 0x22, 0x2C, 0xFF, 0xF2, 0x0B, 0x01, 0x91, 0x6E,
+    0x22, 0x87, 0xFE, 0x82, 0x0A, 0xD4, 0x00, 0x02, 0x4C, 0x01, 0xE1, 0x90, 0x00, 0xD1, 0x70, 0xF2,
+    0xB4, 0xFE, 0x21, 0x6F, 0x81, 0x08, 0x36, 0xD2, 0xDF, 0x00, 0xC1, 0x8F, 0x11, 0x92, 0x11, 0x6E,
+    0xB1, 0x39, 0xE2, 0x49, 0xFE, 0x70, 0xE2, 0x10, 0x01, 0xB0, 0x49, 0xB6, 0xE5, 0x4A, 0xF2, 0x25,
+    0xFF, 0x70, 0x02, 0x82, 0x01, 0x91, 0x72, 0x4A, 0x76, 0xFF, 0x02, 0x5C, 0xFF, 0x06, 0x83, 0x00,
+    0xC2, 0xB7, 0xFE, 0x42, 0x62, 0xFF, 0x22, 0xE7, 0x01, 0x89, 0xF8, 0xEA, 0x16, 0x98, 0xFE, 0x72,
+    0xDA, 0x00, 0xC1, 0xC8, 0x05, 0x93, 0x49, 0xCB, 0x0A, 0x68, 0x01, 0x92, 0xA9, 0x00, 0x26, 0x5A,
+    0xFE, 0x50, 0xF2, 0xDC, 0x00, 0x02, 0x24, 0xFF, 0xFA, 0x90, 0x00, 0xA1, 0x36, 0x02, 0x88, 0xFE,
+    0x70, 0x26, 0xC5, 0x01, 0xA2, 0x24, 0xFF, 0xF1, 0x93, 0x12, 0xA5, 0x00, 0xD9, 0x57, 0x06, 0x88,
+    0xFE, 0x81, 0x09, 0x7C, 0x22, 0xF4, 0x01, 0x91, 0x8E, 0x12, 0x23, 0xFF, 0x21, 0x6D, 0xFA, 0x91,
+    0x00, 0xC6, 0x4A, 0xFE, 0x71, 0x13, 0x12, 0x82, 0x01, 0x89, 0xF8, 0xB1, 0x30, 0x25, 0xDF, 0xD1,
+    0x37, 0xF2, 0xED, 0xFE, 0x79, 0xB7, 0xF2, 0x7D, 0x01, 0x04, 0xAA, 0x5C, 0xFF, 0x21, 0xCB, 0xF1,
+    0x6B, 0xE2, 0xF1, 0xFE, 0x46, 0x0E, 0xFF, 0xA2, 0x9B, 0x00, 0x8A, 0xF8, 0x6E, 0xFE, 0x16, 0x18,
+    0xFF, 0xA2, 0x50, 0xFF, 0xCA, 0x79, 0xFF, 0x86, 0xF8, 0x48, 0xFF, 0x8A, 0xF8, 0xEC, 0xFE, 0x01,
+    0xE2, 0x82, 0xF6, 0x0B, 0xFF, 0x00, 0x01, 0xC0, 0xB5, 0xDB, 0x08, 0x05, 0x01, 0xF1, 0xEF, 0x82,
+    0x15, 0x30, 0x02, 0x42, 0x90, 0x00, 0xD1, 0x93, 0x01, 0xBB, 0xED, 0xE7, 0xFF, 0xEC, 0xBE, 0xD8,
+    0xFF, 0xB2, 0xFE, 0x3D, 0xCF, 0xFF, 0xF6, 0x0D, 0xEF, 0xFF, 0xC8, 0x0D, 0xE1, 0xFF, 0xE9, 0x7D,
+    0xF8, 0xFF, 0x30, 0xFD, 0xFB, 0xFF, 0xF1, 0x49, 0x29, 0xF9, 0xF4, 0x41, 0x2E, 0x00, 0x21, 0x18,
+    0x31, 0x32, 0x41, 0x28, 0xF1, 0xF2, 0x39, 0x29, 0xF1, 0x0C, 0x11, 0xF2, 0x21, 0x1D, 0xF5, 0xF3,
+    0x00, 0x08, 0x01, 0xF0, 0xF1, 0x2B, 0x21, 0xF2, 0x25, 0x10, 0xF5, 0x10, 0x09, 0xF0, 0x19, 0x0C,
+    0x00, 0x00, 0x05, 0x1F, 0x11, 0xF1, 0x10, 0xF0, 0xE9, 0xE2, 0x04, 0x09, 0xF2, 0xF4, 0xF1, 0x1E,
+    0x21, 0xF2, 0x21, 0x1C, 0xF9, 0x1B, 0x30, 0x11, 0x0F, 0x00, 0x15, 0x03, 0x11, 0x1F, 0x09, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x12, 0xF0, 0x09, 0xEE, 0x10, 0x05, 0x0F, 0xF1, 0xF4, 0x00, 0x00,
+    0xF9, 0xED, 0x01, 0xF1, 0x11, 0x1F, 0xE1, 0xF0, 0x01, 0xF1, 0x25, 0x22, 0xE9, 0xE1, 0x11, 0xFD,
+    0xF0, 0x01, 0x1F, 0x20, 0x11, 0x0F, 0x01, 0x20, 0x11, 0xF1, 0x11, 0x0F, 0xF1, 0x10, 0x11, 0xF0,
+    0x10, 0x01, 0x10, 0xF5, 0xF3, 0x09, 0xFD, 0x00, 0x01, 0x20, 0x11, 0xF0, 0x20, 0x05, 0x14, 0x01,
+    0x10, 0xF1, 0xF0, 0x09, 0xFC, 0xF1, 0xF0, 0xF5, 0x10, 0x11, 0xF4, 0x21, 0x10, 0x09, 0x0C, 0x11,
+    0x11, 0x00, 0x11, 0x10, 0xF0, 0x05, 0x16, 0x19, 0xEF, 0x01, 0xFB, 0x00, 0x01, 0x11, 0x01, 0xEF,
+    0x10, 0x05, 0xF4, 0xF9, 0x0C, 0xF1, 0xF0, 0xF1, 0xEF, 0x11, 0x11, 0x01, 0x10, 0xF0, 0x15, 0xF4,
+    0x11, 0x11, 0x09, 0xFB, 0x00, 0xF1, 0xF0, 0x21, 0x10, 0x01, 0xF0, 0x01, 0x21, 0xF1, 0xEF, 0x00,
+    0x21, 0x22, 0xF1, 0xEF, 0xF5, 0x05, 0x01, 0xEF, 0xF9, 0xEB, 0x11, 0x10, 0x00, 0x05, 0x05, 0x11,
+    0xEF, 0x01, 0x11, 0x21, 0x33, 0xF9, 0xEA, 0x00, 0x11, 0x12, 0x00, 0xF0, 0x00, 0x01, 0xEE, 0x11,
+    0x12, 0xF1, 0xEE, 0xF0, 0x01, 0xEF, 0x15, 0xF4, 0x09, 0x11, 0xF1, 0xFB, 0xF1, 0xEF, 0x01, 0xF0,
+    0x05, 0x15, 0x11, 0x11, 0xF1, 0xEF, 0xF9, 0xEB, 0x21, 0x21, 0x05, 0x27, 0x29, 0x1E, 0x05, 0xE2,
+    0xE1, 0xDE, 0x10, 0xF9, 0xEA, 0xF0, 0x01, 0xF0, 0x05, 0x04, 0x01, 0x11, 0xE0, 0x09, 0xEB, 0x10,
+    0xF1, 0xEF, 0x01, 0x21, 0x01, 0xDF, 0x01, 0xE0, 0xE1, 0xF0, 0xD1, 0xE0, 0xE1, 0xE1, 0xF1, 0xD4,
+    0xC1, 0xE3, 0xE5, 0xC9, 0xE1, 0xD7, 0xB1, 0xE6, 0xF1, 0xF3, 0xE9, 0xE6, 0x21, 0x18, 0xF1, 0xF4,
+    0xF1, 0xF4, 0xD1, 0xDB, 0xE1, 0xE9, 0x00, 0xE1, 0xEA, 0xC5, 0xD6, 0xC1, 0xD8, 0x01, 0xED, 0xE8,
+    0xC1, 0xDB, 0x00, 0xE1, 0xEE, 0x00, 0x91, 0xC9, 0x04, 0x21, 0x0E, 0x08, 0x00, 0x00, 0xF1, 0xF8,
+    0x00, 0x01, 0xF3, 0xE0, 0x08, 0xF5, 0xFA, 0x00, 0x61, 0x2A, 0x00, 0xF1, 0xF8, 0x00, 0x11, 0x08,
+    0x00, 0xC1, 0xE3, 0x04, 0x29, 0x0E, 0x00, 0xF1, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFA, 0xD1, 0xF3,
+    0x00, 0x31, 0x13, 0x01, 0x31, 0x60, 0x01, 0xE6, 0xD0, 0x11, 0x08, 0x00, 0xD1, 0xE9, 0x04, 0x21,
+    0x10, 0x00, 0xD9, 0xE9, 0x01, 0xFF, 0x11, 0x08, 0x00, 0x00, 0xB1, 0xDF, 0x00, 0x01, 0x13, 0x30,
+    0x01, 0x06, 0x10, 0x00, 0x00, 0x00, 0x11, 0x08, 0x00, 0xF1, 0xF8, 0x00, 0x51, 0x28, 0x01, 0xEF,
+    0xE1, 0x01, 0x09, 0x07, 0x10, 0x01, 0xE1, 0xC4, 0x85, 0x0D, 0x72, 0x11, 0x09, 0x01, 0x0A, 0x19,
+    0xFF, 0xF1, 0xF6, 0x00, 0x41, 0x28, 0x01, 0xEC, 0xE1, 0x0A, 0x10, 0xF1, 0xF6, 0x51, 0x34, 0xF1,
+    0xF5, 0x00, 0xE5, 0xEC, 0x29, 0x14, 0x01, 0x0B, 0x11, 0xF5, 0xF1, 0xF6, 0xF0, 0xE5, 0xEC, 0x11,
+    0x0A, 0xE9, 0xEB, 0x01, 0xF6, 0xF0, 0xE5, 0xED, 0x11, 0x0A, 0x01, 0xED, 0xE8, 0xF1, 0xF7, 0xF1,
+    0xF7, 0x01, 0x12, 0x20, 0x41, 0x26, 0xE1, 0xEC, 0x01, 0xF7, 0xF0, 0xF1, 0xF7, 0x41, 0x26, 0xE1,
+    0xEC, 0x00, 0x00, 0xF1, 0xF7, 0x21, 0x13, 0x01, 0xED, 0xE0, 0x11, 0x09, 0x11, 0x0A, 0xF1, 0xED,
+    0xF0, 0xF1, 0xF7, 0xD1, 0xE6, 0x01, 0x23, 0x40, 0xF1, 0xF7, 0x51, 0x30, 0xF1, 0xF6, 0x00, 0x00,
+    0xD1, 0xE3, 0xE5, 0xEE, 0x00, 0xE1, 0xEF, 0xE9, 0xEC, 0x00, 0xF1, 0xF7, 0x00, 0xD1, 0xE6, 0x00,
+    0x00, 0x00, 0xC1, 0xE3, 0x00, 0x31, 0x15, 0x00, 0xE1, 0xE4, 0xE0, 0x00, 0xF1, 0xFA, 0x00, 0x00,
+    0xC9, 0xE6, 0xF0, 0x00, 0x05, 0x09, 0x20, 0x00, 0x31, 0x11, 0x00, 0x01, 0xF4, 0xE0, 0x00, 0x00,
+    0x05, 0x01, 0x08, 0x09, 0xF5, 0xD1, 0xFC, 0x04, 0x81, 0x09, 0x35, 0x01, 0x20, 0x40, 0x81, 0x08,
+    0x49, 0x21, 0x13, 0x00, 0x05, 0x01, 0xE1, 0xED, 0x11, 0x09, 0x29, 0x13, 0x01, 0xEC, 0xE0, 0x00,
+    0xE1, 0xEE, 0x01, 0x12, 0x20, 0xF1, 0xF7, 0x11, 0x09, 0x01, 0xEE, 0xE4, 0x00, 0x08, 0x01, 0x12,
+    0x20, 0x41, 0x28, 0xE1, 0xEB, 0x01, 0x01, 0x01, 0xDA, 0x81, 0xF1, 0xA0, 0x00, 0x00, 0xB1, 0xD9,
+    0xC1, 0xEE, 0xD1, 0xF5, 0xF0, 0x00, 0x00, 0x41, 0x0F, 0x00, 0x00, 0x00, 0xE1, 0xF8, 0x00, 0x08,
+    0x00, 0x00, 0xF5, 0xFC, 0xE1, 0xFA, 0xF1, 0xFE, 0xF1, 0xFE, 0xF1, 0xFE, 0x00, 0xF1, 0xFE, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x04, 0x20, 0x00, 0x81, 0x0B, 0x2A, 0x00, 0x00, 0xE1, 0xF0,
+    0xC1, 0xF0, 0xE1, 0xFA, 0xF1, 0xFE, 0xF9, 0xFD, 0xF1, 0xFF, 0xF0, 0x05, 0xFE, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xF1, 0xFF, 0x00, 0x00, 0x81, 0x0F, 0x35, 0x82, 0x16, 0xC0, 0x00,
+    0x91, 0x84, 0x81, 0xF2, 0xB6, 0xB1, 0xE8, 0xC1, 0xF8, 0xE1, 0xFA, 0xF1, 0xFE, 0xF1, 0xFE, 0xF1,
+    0xFE, 0x00, 0xF1, 0xFE, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 0x08, 0x04, 0x04, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x04, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,240 @@
+/* Host benchmark for the PeloMon frame decoder and ride integrator.
+ *
+ * Streams recorded Peloton traffic through the same stages the firmware
+ * runs per message and reports the throughput of each:
+ *      decode  FrameDecoder::feed over the raw bytes of each line
+ *      message HUMessage/BikeMessage construction from decoded frames
+ *      ride    RideStatus::update on the bike's ride metrics
+ *
+ * Inputs are peloton_decoding/example-ride.txt (bike payloads in text hex,
+ * one RPM/power/resistance triple per line, framed here the way the bike
+ * sends them) and resistance-stepped-10s.bin (raw traffic from both lines).
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "pelomon_host.h"
+
+uint8_t LOG_LEVEL = LOG_LEVEL_NONE;
+Logger logger;
+
+// Keep each stage at it long enough for a stable figure
+static const double MIN_STAGE_SECONDS = 0.25;
+// Ride messages arrive about this often
+static const unsigned long MESSAGE_INTERVAL_MICROS = 100000;
+
+struct Trace {
+    std::string name;
+    std::vector<uint8_t> hu_bytes;
+    std::vector<uint8_t> bike_bytes;
+    std::vector<FrameDecoder> hu_frames;
+    std::vector<FrameDecoder> bike_frames;
+};
+
+static volatile uint32_t sink;
+
+static double now_seconds() {
+    using namespace std::chrono;
+    return duration_cast<duration<double> >(
+        steady_clock::now().time_since_epoch()).count();
+}
+
+static void append_bike_frame(std::vector<uint8_t>& out, const uint8_t request,
+                              const uint8_t* payload, const uint8_t len) {
+    uint8_t checksum = 0xF1 + request + len;
+    out.push_back(0xF1);
+    out.push_back(request);
+    out.push_back(len);
+    for (uint8_t i = 0; i < len; i++) {
+        out.push_back(payload[i]);
+        checksum += payload[i];
+    }
+    out.push_back(checksum);
+    out.push_back(0xF6);
+}
+
+static void append_hu_frame(std::vector<uint8_t>& out, const uint8_t request) {
+    out.push_back(0xF5);
+    out.push_back(request);
+    out.push_back((uint8_t) (0xF5 + request));
+    out.push_back(0xF6);
+}
+
+static bool load_example_ride(const char* path, Trace& trace) {
+    // Each line: 3 bytes of RPM, 5 of power, 4 of resistance payload
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    unsigned int b[12];
+    while (fscanf(f, "%x %x %x %x %x %x %x %x %x %x %x %x",
+                  &b[0], &b[1], &b[2], &b[3], &b[4], &b[5],
+                  &b[6], &b[7], &b[8], &b[9], &b[10], &b[11]) == 12) {
+        uint8_t payload[12];
+        for (int i = 0; i < 12; i++) payload[i] = b[i];
+        append_hu_frame(trace.hu_bytes, RPM);
+        append_bike_frame(trace.bike_bytes, RPM, payload, 3);
+        append_hu_frame(trace.hu_bytes, POWER);
+        append_bike_frame(trace.bike_bytes, POWER, payload + 3, 5);
+        append_hu_frame(trace.hu_bytes, RESISTANCE);
+        append_bike_frame(trace.bike_bytes, RESISTANCE, payload + 8, 4);
+    }
+    fclose(f);
+    return true;
+}
+
+static bool load_wire_dump(const char* path, Trace& trace) {
+    // Both lines interleaved; split by header so each decoder sees only
+    // its own line, as on the hardware.
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    std::vector<uint8_t> raw;
+    int c;
+    while ((c = fgetc(f)) != EOF) raw.push_back((uint8_t) c);
+    fclose(f);
+    size_t i = 0;
+    while (i < raw.size()) {
+        const uint8_t header = raw[i];
+        size_t len;
+        std::vector<uint8_t>* line;
+        if (header == 0xF1 && i + 2 < raw.size()) {
+            len = raw[i + 2] + 5;
+            line = &trace.bike_bytes;
+        } else if (header == 0xF5 || header == 0xF7 || header == 0xFE) {
+            len = 4;
+            line = &trace.hu_bytes;
+        } else {
+            i++;
+            continue;
+        }
+        if (i + len > raw.size()) break;
+        line->insert(line->end(), raw.begin() + i, raw.begin() + i + len);
+        i += len;
+    }
+    return true;
+}
+
+static void report(const Trace& trace, const char* stage, const size_t frames,
+                   const double seconds) {
+    printf("%-28s %-8s %8zu frames %12.0f frames/s %9.1f ns/frame\n",
+           trace.name.c_str(), stage, frames, frames / seconds,
+           seconds * 1e9 / frames);
+}
+
+static size_t decode_line(const std::vector<uint8_t>& bytes, const bool from_bike,
+                          std::vector<FrameDecoder>* frames) {
+    FrameDecoder decoder(from_bike);
+    size_t count = 0;
+    for (size_t i = 0; i < bytes.size(); i++) {
+        if (decoder.feed(bytes[i]) != FRAME_INCOMPLETE) {
+            count++;
+            if (frames) frames->push_back(decoder);
+        }
+    }
+    sink += decoder.counters.errors();
+    return count;
+}
+
+static void bench_decode(Trace& trace) {
+    decode_line(trace.hu_bytes, false, &trace.hu_frames);
+    decode_line(trace.bike_bytes, true, &trace.bike_frames);
+    const size_t frames = trace.hu_frames.size() + trace.bike_frames.size();
+    size_t total = 0;
+    const double start = now_seconds();
+    double elapsed;
+    do {
+        total += decode_line(trace.hu_bytes, false, NULL);
+        total += decode_line(trace.bike_bytes, true, NULL);
+        elapsed = now_seconds() - start;
+    } while (elapsed < MIN_STAGE_SECONDS);
+    report(trace, "decode", frames, elapsed * frames / total);
+}
+
+static void bench_messages(const Trace& trace) {
+    const size_t frames = trace.hu_frames.size() + trace.bike_frames.size();
+    size_t total = 0;
+    const double start = now_seconds();
+    double elapsed;
+    do {
+        for (size_t i = 0; i < trace.hu_frames.size(); i++) {
+            HUMessage msg(trace.hu_frames[i]);
+            sink += msg.request + msg.is_valid;
+        }
+        for (size_t i = 0; i < trace.bike_frames.size(); i++) {
+            BikeMessage msg(trace.bike_frames[i]);
+            sink += msg.value + msg.is_valid;
+        }
+        total += frames;
+        elapsed = now_seconds() - start;
+    } while (elapsed < MIN_STAGE_SECONDS);
+    report(trace, "message", frames, elapsed * frames / total);
+}
+
+static void build_resistance_lut(ResistanceLUT& lut) {
+    // Same table the simulator serves
+    uint16_t resistance = 0;
+    for (uint8_t i = 0; i <= READ_RESISTANCE_TABLE_1E; i++) {
+        resistance += pgm_read_byte(RESISTANCE_LUT_DELTA_ENCODED + i);
+        lut.update_entry(resistance, i);
+    }
+    while (lut.sync_step());
+}
+
+static void bench_ride(const Trace& trace, ResistanceLUT& lut) {
+    std::vector<BikeMessage> metrics;
+    for (size_t i = 0; i < trace.bike_frames.size(); i++) {
+        BikeMessage msg(trace.bike_frames[i]);
+        if (msg.is_valid && (msg.request == RPM || msg.request == POWER ||
+                             msg.request == RESISTANCE))
+            metrics.push_back(msg);
+    }
+    if (metrics.empty()) return;
+    RideStatus ride(logger);
+    size_t total = 0;
+    double elapsed = 0;
+    do {
+        ride.initialize();
+        host_set_micros(MESSAGE_INTERVAL_MICROS);
+        const double start = now_seconds();
+        for (size_t i = 0; i < metrics.size(); i++) {
+            ride.update(metrics[i], lut);
+            host_advance_micros(MESSAGE_INTERVAL_MICROS);
+        }
+        elapsed += now_seconds() - start;
+        total += metrics.size();
+    } while (elapsed < MIN_STAGE_SECONDS);
+    report(trace, "ride", metrics.size(), elapsed * metrics.size() / total);
+    // Totals double as a quick check that the integrators still agree
+    printf("%-28s %-8s %u kJ, %u crank revs, %u wheel revs\n",
+           trace.name.c_str(), "totals", ride.total_kj(),
+           ride.integral_crank_revolutions(),
+           (unsigned) ride.integral_wheel_revolutions());
+}
+
+int main(int argc, char** argv) {
+    const std::string data_dir = argc > 1 ? argv[1] : PELOMON_DATA_DIR;
+    ResistanceLUT lut(logger);
+    lut.initialize();
+    build_resistance_lut(lut);
+
+    Trace traces[2];
+    traces[0].name = "example-ride.txt";
+    traces[1].name = "resistance-stepped-10s.bin";
+    if (!load_example_ride((data_dir + "/example-ride.txt").c_str(), traces[0]) ||
+        !load_wire_dump((data_dir + "/resistance-stepped-10s.bin").c_str(), traces[1])) {
+        fprintf(stderr, "could not read traces from %s\n", data_dir.c_str());
+        return 1;
+    }
+    for (int t = 0; t < 2; t++) {
+        bench_decode(traces[t]);
+        bench_messages(traces[t]);
+        bench_ride(traces[t], lut);
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+/* Command-line decoder for Peloton wire captures.
+ *
+ * Streams a raw capture of both lines (the format of
+ * peloton_decoding/resistance-stepped-10s.bin) through the firmware's own
+ * FrameDecoder, HUMessage and BikeMessage, and writes one row per
+ * terminated frame, valid or not, for plotting:
+ *
+ *      offset,line,header,request,value,valid
+ *
+ * offset is the byte offset of the frame's header in the capture; value
+ * is the decoded payload of bike frames and 0 for the head unit.
+ * With --binary, rows are instead packed little-endian records of
+ *      [offset: 4] [flags: 1] [request: 1] [value: 2]
+ * where flags bit 0 is set for bike frames and bit 1 for valid ones, so
+ * the file loads straight into numpy with a structured dtype.
+ *
+ * Usage: pelomon_decode [--binary] capture.bin [output]
+ * Either path may be - for stdin or stdout. Frame counts by outcome go to
+ * stderr at the end.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#include <string.h>
+
+#include "pelomon_host.h"
+
+uint8_t LOG_LEVEL = LOG_LEVEL_NONE;
+Logger logger;
+
+static const size_t INPUT_BLOCK_LEN = 1 << 20;
+static const size_t OUTPUT_BLOCK_LEN = 1 << 20;
+// Longest CSV row, with room to spare
+static const size_t MAX_ROW_LEN = 48;
+static const size_t RECORD_LEN = 8;
+
+#define RECORD_FROM_BIKE 0x01
+#define RECORD_VALID 0x02
+
+class RowWriter {
+    public:
+    unsigned long long frames;
+    unsigned long long invalid;
+
+    RowWriter(FILE* out_, const bool binary_): frames(0), invalid(0), out(out_),
+                                               binary(binary_), len(0), ok(true) {
+        if (!binary) append("offset,line,header,request,value,valid\n");
+    }
+    ~RowWriter() {
+        flush();
+    }
+    void frame(const uint32_t offset, const FrameDecoder& frame, const bool from_bike) {
+        uint16_t value = 0;
+        uint8_t request;
+        bool valid;
+        if (from_bike) {
+            BikeMessage msg(frame);
+            request = msg.request;
+            value = msg.value;
+            valid = msg.is_valid;
+        } else {
+            HUMessage msg(frame);
+            request = msg.request;
+            valid = msg.is_valid;
+        }
+        frames++;
+        if (!valid) invalid++;
+        if (len + MAX_ROW_LEN > OUTPUT_BLOCK_LEN) flush();
+        if (binary) {
+            uint8_t* record = block + len;
+            for (uint8_t i = 0; i < 4; i++) record[i] = offset >> (8 * i);
+            record[4] = (from_bike ? RECORD_FROM_BIKE : 0) | (valid ? RECORD_VALID : 0);
+            record[5] = request;
+            record[6] = value & 0xFF;
+            record[7] = value >> 8;
+            len += RECORD_LEN;
+            return;
+        }
+        Formatter row((char*) block + len, MAX_ROW_LEN);
+        row.dec(offset).str(from_bike ? ",bike," : ",hu,")
+           .hex8(frame.header()).chr(',').hex8(request).chr(',')
+           .dec(value).chr(',').chr(valid ? '1' : '0').chr('\n');
+        len += row.length();
+    }
+    bool flush() {
+        if (len && fwrite(block, 1, len, out) != len) ok = false;
+        len = 0;
+        return ok;
+    }
+
+    private:
+    FILE* const out;
+    const bool binary;
+    uint8_t block[OUTPUT_BLOCK_LEN];
+    size_t len;
+    bool ok;
+
+    void append(const char* text) {
+        const size_t n = strlen(text);
+        memcpy(block + len, text, n);
+        len += n;
+    }
+};
+
+/* Both lines share one capture, and a frame of one never interleaves
+ * with a frame of the other, so a frame in progress keeps every byte
+ * until it finishes and otherwise the header picks the line. A corrupt
+ * length can cost at most one frame of the other line, because frame
+ * lengths are bounded.
+ */
+static void decode(FILE* in, RowWriter& rows, FrameDecoder& hu, FrameDecoder& bike) {
+    static uint8_t block[INPUT_BLOCK_LEN];
+    uint32_t offset = 0;
+    uint32_t hu_start = 0, bike_start = 0;
+    size_t n;
+    while ((n = fread(block, 1, INPUT_BLOCK_LEN, in)) > 0) {
+        for (size_t i = 0; i < n; i++, offset++) {
+            const uint8_t b = block[i];
+            const bool to_bike = bike.in_frame() || (!hu.in_frame() && b == 0xF1);
+            FrameDecoder& line = to_bike ? bike : hu;
+            const FrameStatus status = line.feed(b);
+            // Just took a header, whether or not it cut a frame short
+            if (line.in_frame() && line.len == 1) {
+                if (to_bike) bike_start = offset;
+                else hu_start = offset;
+            }
+            if (status != FRAME_INCOMPLETE)
+                rows.frame(to_bike ? bike_start : hu_start, line, to_bike);
+        }
+    }
+}
+
+static void report(const char* name, const FrameCounters& counters) {
+    fprintf(stderr, "%-4s %u frames, %u skipped bytes, %u truncated, %u bad length, "
+            "%u bad checksum, %u bad digits, %u bad terminator\n",
+            name, counters.frames, counters.skipped, counters.truncated,
+            counters.bad_length, counters.bad_checksum, counters.bad_digits,
+            counters.bad_terminator);
+}
+
+int main(int argc, char** argv) {
+    bool binary = false;
+    int arg = 1;
+    if (arg < argc && strcmp(argv[arg], "--binary") == 0) {
+        binary = true;
+        arg++;
+    }
+    if (arg >= argc || argc - arg > 2) {
+        fprintf(stderr, "usage: %s [--binary] capture.bin [output]\n", argv[0]);
+        return 2;
+    }
+    const char* in_path = argv[arg];
+    const char* out_path = arg + 1 < argc ? argv[arg + 1] : "-";
+    FILE* in = strcmp(in_path, "-") ? fopen(in_path, "rb") : stdin;
+    if (!in) {
+        perror(in_path);
+        return 1;
+    }
+    FILE* out = strcmp(out_path, "-") ? fopen(out_path, "wb") : stdout;
+    if (!out) {
+        perror(out_path);
+        return 1;
+    }
+
+    FrameDecoder hu(false), bike(true);
+    // Too big for the stack
+    RowWriter* rows = new RowWriter(out, binary);
+    decode(in, *rows, hu, bike);
+    const bool written = rows->flush();
+    fprintf(stderr, "%llu frames, %llu invalid\n", rows->frames, rows->invalid);
+    delete rows;
+    if (ferror(in)) {
+        perror(in_path);
+        return 1;
+    }
+    if (!written || fclose(out) != 0) {
+        perror(out_path);
+        return 1;
+    }
+    // The decoders' own counters are 16 bits and wrap on long captures
+    report("hu", hu.counters);
+    report("bike", bike.counters);
+    return 0;
+}
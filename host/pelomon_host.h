@@ -0,0 +1,36 @@
+/* Pulls in the PeloMon protocol and ride classes for a host build,
+ * in the same order pelomon.ino includes them.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _PELOMON_HOST_H_
+#define _PELOMON_HOST_H_
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+#include <EEPROM.h>
+
+#include "settings.h"
+#include "sram.h"
+
+// Logger only needs somewhere to send BLE UART output
+class Adafruit_BLE {
+    public:
+    int writeBLEUart(uint8_t const* buffer, int size) { return size; }
+    bool atcommand_pending() const { return false; }
+};
+
+extern uint8_t LOG_LEVEL;
+
+#include "logger.h"
+#include "fmt.h"
+#include "resistance_lut.h"
+#include "profiler.h"
+#include "peloton.h"
+#include "speed_table.h"
+#include "RideStatus.h"
+#endif
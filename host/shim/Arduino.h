@@ -0,0 +1,87 @@
+/* Minimal Arduino core for building PeloMon code on the host.
+ *
+ * Only what the header-only protocol and ride classes touch is here.
+ * Time is a virtual clock the caller advances, and the AVR registers are
+ * plain variables, so interrupt-driven code compiles but never fires.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "avr/pgmspace.h"
+#include "avr/io.h"
+
+#define F_CPU 8000000UL
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LED_BUILTIN 13
+#define A0 18
+#define A1 19
+#define A2 20
+#define A3 21
+#define A4 22
+#define A5 23
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// Virtual clock
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void host_set_micros(unsigned long us);
+void host_advance_micros(unsigned long us);
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+#define digitalPinToPort(p) ((uint8_t) (p))
+#define digitalPinToBitMask(p) ((uint8_t) 1)
+#define portInputRegister(port) (&PINB)
+#define digitalPinToPCICR(p) (&PCICR)
+#define digitalPinToPCICRbit(p) 0
+#define digitalPinToPCMSK(p) (&PCMSK0)
+#define digitalPinToPCMSKbit(p) ((p) - 4)
+
+// USB serial. Output goes to stdout, and only while "connected".
+class HostSerial {
+    public:
+    bool connected;
+    HostSerial(): connected(false) {}
+    void begin(unsigned long) {}
+    operator bool() const { return connected; }
+    int available() { return 0; }
+    int read() { return -1; }
+    int availableForWrite() { return 64; }
+    size_t write(const uint8_t* buf, size_t len) {
+        return connected ? fwrite(buf, 1, len, stdout) : len;
+    }
+    size_t write(const char* buf, size_t len) {
+        return write((const uint8_t*) buf, len);
+    }
+    size_t print(const char* str) { return write(str, strlen(str)); }
+    size_t print(char c) { return write(&c, 1); }
+    size_t print(const __FlashStringHelper* str) {
+        return print((const char*) str);
+    }
+    size_t println(const char* str) { return print(str) + print('\n'); }
+    size_t println(const __FlashStringHelper* str) {
+        return print(str) + print('\n');
+    }
+};
+extern HostSerial Serial;
+#endif
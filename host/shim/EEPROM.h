@@ -0,0 +1,18 @@
+/* Host stand-in for the Arduino EEPROM library, backed by RAM. */
+#ifndef _HOST_EEPROM_H_
+#define _HOST_EEPROM_H_
+#include <stdint.h>
+
+#define HOST_EEPROM_SIZE 1024
+
+class HostEEPROM {
+    public:
+    uint8_t data[HOST_EEPROM_SIZE];
+    HostEEPROM() { for (int i = 0; i < HOST_EEPROM_SIZE; data[i++] = 0xFF); }
+    uint8_t read(int address) const { return data[address]; }
+    void write(int address, uint8_t value) { data[address] = value; }
+    void update(int address, uint8_t value) { data[address] = value; }
+    int length() const { return HOST_EEPROM_SIZE; }
+};
+extern HostEEPROM EEPROM;
+#endif
@@ -0,0 +1,35 @@
+/* Definitions for the host Arduino shim.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#include "Arduino.h"
+#include "EEPROM.h"
+
+volatile uint8_t SREG, PINB, PORTF, PCICR, PCMSK0, TCCR1A, TCCR1B, TIMSK1;
+volatile uint16_t TCNT1, OCR1A, OCR1B;
+
+HostSerial Serial;
+HostEEPROM EEPROM;
+
+static unsigned long host_micros = 0;
+
+unsigned long millis() {
+    return host_micros / 1000;
+}
+unsigned long micros() {
+    return host_micros;
+}
+void delay(unsigned long ms) {
+    host_micros += ms * 1000;
+}
+void host_set_micros(unsigned long us) {
+    host_micros = us;
+}
+void host_advance_micros(unsigned long us) {
+    host_micros += us;
+}
@@ -0,0 +1,6 @@
+/* Host stand-in for avr/eeprom.h. The RAM-backed EEPROM is always ready. */
+#ifndef _HOST_AVR_EEPROM_H_
+#define _HOST_AVR_EEPROM_H_
+
+#define eeprom_is_ready() 1
+#endif
@@ -0,0 +1,11 @@
+/* Host stand-in for avr/interrupt.h. ISRs become plain functions. */
+#ifndef _HOST_AVR_INTERRUPT_H_
+#define _HOST_AVR_INTERRUPT_H_
+#include "avr/io.h"
+
+#define ISR(vector) void vector(void)
+inline void cli() {}
+inline void sei() {}
+inline void interrupts() {}
+inline void noInterrupts() {}
+#endif
@@ -0,0 +1,23 @@
+/* Host stand-in for the AVR registers the PeloMon code touches. */
+#ifndef _HOST_AVR_IO_H_
+#define _HOST_AVR_IO_H_
+#include <stdint.h>
+
+#define _BV(bit) (1 << (bit))
+
+extern volatile uint8_t SREG;
+extern volatile uint8_t PINB;
+extern volatile uint8_t PORTF;
+extern volatile uint8_t PCICR;
+extern volatile uint8_t PCMSK0;
+extern volatile uint8_t TCCR1A;
+extern volatile uint8_t TCCR1B;
+extern volatile uint8_t TIMSK1;
+extern volatile uint16_t TCNT1;
+extern volatile uint16_t OCR1A;
+extern volatile uint16_t OCR1B;
+
+#define CS11 1
+#define OCIE1A 1
+#define OCIE1B 2
+#endif
@@ -0,0 +1,24 @@
+/* Host stand-in for avr/pgmspace.h: flash is ordinary memory. */
+#ifndef _HOST_PGMSPACE_H_
+#define _HOST_PGMSPACE_H_
+#include <string.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*) (addr))
+#define pgm_read_word(addr) (*(const uint16_t*) (addr))
+#define pgm_read_dword(addr) (*(const uint32_t*) (addr))
+#define pgm_read_ptr(addr) (*(void* const*) (addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strnlen_P strnlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define snprintf_P snprintf
+
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper*) (s))
+#endif
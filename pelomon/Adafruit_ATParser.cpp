@@ -50,6 +50,7 @@ Adafruit_ATParser::Adafruit_ATParser(void)
 {
   _mode    = BLUEFRUIT_MODE_COMMAND;
   _verbose = false;
+  _async_pending = false;
 }
 
 /******************************************************************************/
@@ -81,7 +82,7 @@ bool Adafruit_ATParser::waitForOK(void)
     @param
 */
 /******************************************************************************/
-bool Adafruit_ATParser::send_arg_get_resp(int32_t* reply, uint8_t argcount, uint16_t argtype[], uint32_t args[])
+void Adafruit_ATParser::send_args(uint8_t argcount, uint16_t argtype[], uint32_t args[])
 {
   // Command arguments according to its type
   for(uint8_t i=0; i<argcount; i++)
@@ -132,6 +133,17 @@ bool Adafruit_ATParser::send_arg_get_resp(int32_t* reply, uint8_t argcount, uint
     if (i != argcount-1) print(',');
   }
   println(); // execute command
+}
+
+/******************************************************************************/
+/*!
+    @brief
+    @param
+*/
+/******************************************************************************/
+bool Adafruit_ATParser::send_arg_get_resp(int32_t* reply, uint8_t argcount, uint16_t argtype[], uint32_t args[])
+{
+  send_args(argcount, argtype, args);
 
   // parse integer response if required
   if (reply)
@@ -153,6 +165,7 @@ bool Adafruit_ATParser::send_arg_get_resp(int32_t* reply, uint8_t argcount, uint
 bool Adafruit_ATParser::atcommand_full(const char cmd[], int32_t* reply, uint8_t argcount, uint16_t argtype[], uint32_t args[])
 {
   bool result;
+  atcommand_finish();
   uint8_t current_mode = _mode;
 
   // switch mode if necessary to execute command
@@ -177,6 +190,7 @@ bool Adafruit_ATParser::atcommand_full(const char cmd[], int32_t* reply, uint8_t
 bool Adafruit_ATParser::atcommand_full(const __FlashStringHelper *cmd, int32_t* reply, uint8_t argcount, uint16_t argtype[], uint32_t args[])
 {
   bool result;
+  atcommand_finish();
   uint8_t current_mode = _mode;
 
   // switch mode if necessary to execute command
@@ -192,6 +206,118 @@ bool Adafruit_ATParser::atcommand_full(const __FlashStringHelper *cmd, int32_t*
   return result;
 }
 
+/******************************************************************************/
+/*!
+    @brief  Send a command without waiting for its response. The OK/ERROR
+            status is collected later by atcommand_poll(), so the caller can
+            do other work while the module processes the command. Only one
+            command may be outstanding; any other command finishes it first.
+*/
+/******************************************************************************/
+bool Adafruit_ATParser::atcommand_begin(const __FlashStringHelper *cmd, uint8_t argcount, uint16_t argtype[], uint32_t args[])
+{
+  async_begin();
+
+  print(cmd);
+  send_args(argcount, argtype, args);
+
+  _async_started = millis();
+  return true;
+}
+
+/******************************************************************************/
+/*!
+    @brief  As above, for a command line the caller has already formatted
+*/
+/******************************************************************************/
+bool Adafruit_ATParser::atcommand_begin(const char line[], uint8_t len)
+{
+  async_begin();
+
+  writeCommandLine(line, len);
+
+  _async_started = millis();
+  return true;
+}
+
+void Adafruit_ATParser::async_begin(void)
+{
+  atcommand_finish();
+
+  _async_mode = _mode;
+  if ( _async_mode == BLUEFRUIT_MODE_DATA ) setMode(BLUEFRUIT_MODE_COMMAND);
+
+  _async_pending = true;
+  _async_linelen = 0;
+  _async_timeout = 2*_timeout;
+}
+
+/******************************************************************************/
+/*!
+    @brief  Consume whatever response data the module has ready without
+            blocking.
+    @return AT_ASYNC_PENDING while waiting, AT_ASYNC_OK or AT_ASYNC_ERROR once
+            the command has completed, AT_ASYNC_IDLE if nothing is outstanding
+*/
+/******************************************************************************/
+uint8_t Adafruit_ATParser::atcommand_poll(void)
+{
+  if (!_async_pending) return AT_ASYNC_IDLE;
+
+  uint8_t status = AT_ASYNC_PENDING;
+
+  // available() only reports IRQ when the FIFO is empty, so this never
+  // waits on a module that has nothing to say yet
+  while ( status == AT_ASYNC_PENDING && available() )
+  {
+    int c = read();
+    if (c < 0) break;
+    if (c == '\r') continue;
+
+    if (c == '\n')
+    {
+      if (_async_linelen == 0) continue;
+      _async_line[_async_linelen] = 0;
+      if (_verbose) SerialDebug.println(_async_line);
+
+      if ( strcmp(_async_line, "OK") == 0 ) status = AT_ASYNC_OK;
+      else if ( strcmp(_async_line, "ERROR") == 0 ) status = AT_ASYNC_ERROR;
+      _async_linelen = 0;
+    }
+    else if (_async_linelen < sizeof(_async_line) - 1)
+    {
+      _async_line[_async_linelen++] = c;
+    }
+  }
+
+  if ( status == AT_ASYNC_PENDING && millis() - _async_started > _async_timeout )
+  {
+    status = AT_ASYNC_ERROR;
+  }
+
+  if ( status != AT_ASYNC_PENDING )
+  {
+    _async_pending = false;
+    // switch back if necessary
+    if ( _async_mode == BLUEFRUIT_MODE_DATA ) setMode(BLUEFRUIT_MODE_DATA);
+  }
+
+  return status;
+}
+
+/******************************************************************************/
+/*!
+    @brief  Block until the outstanding command (if any) has completed.
+    @return true if there was no command or it ended with OK
+*/
+/******************************************************************************/
+bool Adafruit_ATParser::atcommand_finish(void)
+{
+  uint8_t status;
+  while ( (status = atcommand_poll()) == AT_ASYNC_PENDING ) delay(1);
+  return status != AT_ASYNC_ERROR;
+}
+
 /******************************************************************************/
 /*!
     @brief Send an AT command and get multiline string response into
@@ -207,6 +333,7 @@ bool Adafruit_ATParser::atcommand_full(const __FlashStringHelper *cmd, int32_t*
 uint16_t Adafruit_ATParser::atcommandStrReply(const char cmd[], char* buf, uint16_t bufsize, uint16_t timeout)
 {
   uint16_t result_bytes;
+  atcommand_finish();
   uint8_t current_mode = _mode;
   // switch mode if necessary to execute command
   if ( current_mode == BLUEFRUIT_MODE_DATA ) setMode(BLUEFRUIT_MODE_COMMAND);
@@ -224,6 +351,7 @@ uint16_t Adafruit_ATParser::atcommandStrReply(const char cmd[], char* buf, uint1
 uint16_t Adafruit_ATParser::atcommandStrReply(const __FlashStringHelper *cmd, char* buf, uint16_t bufsize, uint16_t timeout)
 {
   uint16_t result_bytes;
+  atcommand_finish();
   uint8_t current_mode = _mode;
   // switch mode if necessary to execute command
   if ( current_mode == BLUEFRUIT_MODE_DATA ) setMode(BLUEFRUIT_MODE_COMMAND);
@@ -258,6 +386,7 @@ uint16_t Adafruit_ATParser::atcommandStrReplyPerLine(
     void (*line_callback)(void*, char*, uint16_t), void* callback_data)
 {
   uint16_t result_bytes;
+  atcommand_finish();
   uint8_t current_mode = _mode;
   // switch mode if necessary to execute command
   if ( current_mode == BLUEFRUIT_MODE_DATA ) setMode(BLUEFRUIT_MODE_COMMAND);
@@ -283,6 +412,7 @@ uint16_t Adafruit_ATParser::atcommandStrReplyPerLine(
     void (*line_callback)(void*, char*, uint16_t), void* callback_data)
 {
   uint16_t result_bytes;
+  atcommand_finish();
   uint8_t current_mode = _mode;
   // switch mode if necessary to execute command
   if ( current_mode == BLUEFRUIT_MODE_DATA ) setMode(BLUEFRUIT_MODE_COMMAND);
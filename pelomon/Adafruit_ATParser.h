@@ -67,13 +67,32 @@ enum
   AT_ARGTYPE_UINT8     = 0x0800,
 };
 
+// Status of a command issued with atcommand_begin()
+enum
+{
+  AT_ASYNC_IDLE = 0,
+  AT_ASYNC_PENDING,
+  AT_ASYNC_OK,
+  AT_ASYNC_ERROR,
+};
+
 class Adafruit_ATParser : public Stream
 {
 protected:
   uint8_t _mode;
   bool     _verbose;
 
+  // Non-blocking command state
+  bool     _async_pending;
+  uint8_t  _async_mode;
+  uint8_t  _async_linelen;
+  char     _async_line[6];
+  uint16_t _async_timeout;
+  uint32_t _async_started;
+
   // internal function
+  void async_begin(void);
+  void send_args(uint8_t argcount, uint16_t argtype[], uint32_t args[]);
   bool send_arg_get_resp(int32_t* reply, uint8_t argcount, uint16_t argtype[], uint32_t args[]);
 
 public:
@@ -90,6 +109,15 @@ public:
   bool atcommand_full(const char cmd[]               , int32_t* reply, uint8_t argcount, uint16_t argtype[], uint32_t args[]);
   bool atcommand_full(const __FlashStringHelper *cmd , int32_t* reply, uint8_t argcount, uint16_t argtype[], uint32_t args[]);
 
+  //--------------------------------------------------------------------+
+  // Non-blocking: send the command now, collect OK/ERROR from poll()
+  //--------------------------------------------------------------------+
+  bool    atcommand_begin(const __FlashStringHelper *cmd, uint8_t argcount, uint16_t argtype[], uint32_t args[]);
+  bool    atcommand_begin(const char line[], uint8_t len);
+  uint8_t atcommand_poll(void);
+  bool    atcommand_finish(void);
+  bool    atcommand_pending(void) { return _async_pending; }
+
   //--------------------------------------------------------------------+
   // Without Reply
   //--------------------------------------------------------------------+
@@ -268,6 +296,14 @@ public:
   // HELPER
   //--------------------------------------------------------------------+
   int printByteArray(uint8_t const bytearray[], int size);
+
+  // Send a complete, already formatted command line (without terminator).
+  // Transports can override this to skip the per-character write path.
+  virtual void writeCommandLine(const char line[], uint8_t len)
+  {
+    write((uint8_t const*) line, len);
+    println();
+  }
 };
 
 #endif /* _ADAFRUIT_ATPARSER_H_ */
@@ -81,6 +81,7 @@ Adafruit_BLE::Adafruit_BLE(void)
 /******************************************************************************/
 void Adafruit_BLE::install_callback(bool enable, int8_t system_id, int8_t gatts_id)
 {
+  atcommand_finish();
   uint8_t current_mode = _mode;
 
   // switch mode if necessary to execute command
@@ -155,6 +156,7 @@ bool Adafruit_BLE::reset(boolean blocking)
 /******************************************************************************/
 bool Adafruit_BLE::factoryReset(boolean blocking)
 {
+  atcommand_finish();
   println( F("AT+FACTORYRESET") );
   bool isOK = waitForOK();
 
@@ -225,6 +227,7 @@ void Adafruit_BLE::disconnect(void)
 /******************************************************************************/
 void Adafruit_BLE::info(void)
 {
+  atcommand_finish();
   uint8_t current_mode = _mode;
 
   bool v = _verbose;
@@ -257,6 +260,7 @@ void Adafruit_BLE::info(void)
 /**************************************************************************/
 bool Adafruit_BLE::isVersionAtLeast(const char * versionString)
 {
+  atcommand_finish();
   uint8_t current_mode = _mode;
 
   // switch mode if necessary to execute command
@@ -286,6 +290,7 @@ bool Adafruit_BLE::isVersionAtLeast(const char * versionString)
 /******************************************************************************/
 void Adafruit_BLE::update(uint32_t period_ms)
 {
+  atcommand_finish();
   static TimeoutTimer tt;
 
   if ( tt.expired() )
@@ -449,6 +454,7 @@ bool Adafruit_BLE::writeNVM(uint16_t offset, int32_t number)
 /******************************************************************************/
 bool Adafruit_BLE::readNVM(uint16_t offset, uint8_t data[], uint16_t size)
 {
+  atcommand_finish();
   VERIFY_(offset < NVM_USERDATA_SIZE);
 
   uint8_t current_mode = _mode;
@@ -517,6 +523,7 @@ bool Adafruit_BLE::readNVM(uint16_t offset, int32_t* number)
  */
 int Adafruit_BLE::writeBLEUart(uint8_t const * buffer, int size)
 {
+  atcommand_finish();
   uint8_t current_mode = _mode;
 
   // switch mode if necessary to execute command
@@ -538,6 +545,7 @@ int Adafruit_BLE::writeBLEUart(uint8_t const * buffer, int size)
  */
 int  Adafruit_BLE::readBLEUart(uint8_t* buffer, int size)
 {
+  atcommand_finish();
   uint8_t current_mode = _mode;
 
   // switch mode if necessary to execute command
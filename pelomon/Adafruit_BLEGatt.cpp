@@ -92,6 +92,7 @@ uint8_t Adafruit_BLEGatt::addService(uint8_t uuid128[])
 /******************************************************************************/
 uint8_t Adafruit_BLEGatt::addChar_internal(uint8_t uuid[], uint8_t uuid_len, uint8_t properties, uint8_t min_len, uint8_t max_len, BLEDataType_t datatype, const char* description, const GattPresentationFormat* presentFormat)
 {
+  _ble.atcommand_finish();
   bool isOK;
   int32_t chars_id;
   uint8_t current_mode = _ble.getMode();
@@ -193,6 +194,48 @@ bool Adafruit_BLEGatt::setChar(uint8_t charID, uint8_t const data[], uint8_t siz
   return _ble.atcommand_full(F("AT+GATTCHAR"), NULL, 2, argtype, args);
 }
 
+/******************************************************************************/
+/*!
+    @brief Format the AT+GATTCHAR command prefix for a characteristic once so
+           that setCharBegin() only has to append the payload
+    @param
+*/
+/******************************************************************************/
+void Adafruit_BLEGatt::prepareChar(GattCharPrefix& prefix, uint8_t charID)
+{
+  strcpy_P(prefix.text, PSTR("AT+GATTCHAR="));
+  utoa(charID, prefix.text + strlen(prefix.text), 10);
+  prefix.len = strlen(prefix.text);
+  prefix.text[prefix.len++] = ',';
+}
+
+/******************************************************************************/
+/*!
+    @brief Start setting Characteristics value with data buffer. The whole
+           command is formatted in one pass and sent before returning; only
+           the module's response is deferred.
+    @param
+*/
+/******************************************************************************/
+bool Adafruit_BLEGatt::setCharBegin(GattCharPrefix const& prefix, uint8_t const data[], uint8_t size)
+{
+  static const char hex_digits[] = "0123456789ABCDEF";
+  char line[GATT_CHAR_PREFIX_MAXLEN + 3*GATT_CHAR_FAST_MAXLEN];
+
+  if (size == 0 || size > GATT_CHAR_FAST_MAXLEN) return false;
+
+  memcpy(line, prefix.text, prefix.len);
+  char* p = line + prefix.len;
+  for (uint8_t i = 0; i < size; i++)
+  {
+    if (i) *p++ = '-';
+    *p++ = hex_digits[data[i] >> 4];
+    *p++ = hex_digits[data[i] & 0x0F];
+  }
+
+  return _ble.atcommand_begin(line, p - line);
+}
+
 /******************************************************************************/
 /*!
     @brief Set Characteristics value with data buffer
@@ -218,6 +261,7 @@ bool Adafruit_BLEGatt::setChar(uint8_t charID, char const* str)
 /******************************************************************************/
 uint8_t Adafruit_BLEGatt::getChar(uint8_t charID)
 {
+  _ble.atcommand_finish();
   uint8_t current_mode = _ble.getMode();
 
   // switch mode if necessary to execute command
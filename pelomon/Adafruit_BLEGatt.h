@@ -56,6 +56,16 @@ struct GattPresentationFormat
   uint16_t desc;
 };
 
+// Preformatted "AT+GATTCHAR=<id>," for a characteristic that is written often
+#define GATT_CHAR_PREFIX_MAXLEN  17
+#define GATT_CHAR_FAST_MAXLEN    20
+
+struct GattCharPrefix
+{
+  char    text[GATT_CHAR_PREFIX_MAXLEN];
+  uint8_t len;
+};
+
 class Adafruit_BLEGatt
 {
 private:
@@ -114,6 +124,11 @@ public:
   bool    setChar(uint8_t charID, uint8_t const data[], uint8_t size);
   bool    setChar(uint8_t charID, char const *  str);
 
+  // Fast path: send the update with a cached command prefix and without
+  // waiting for OK; see Adafruit_ATParser::atcommand_poll()
+  void    prepareChar(GattCharPrefix& prefix, uint8_t charID);
+  bool    setCharBegin(GattCharPrefix const& prefix, uint8_t const data[], uint8_t size);
+
   bool    setChar(uint8_t charID, uint8_t  data8 ) { return this->setChar(charID, (uint8_t*) &data8, 1); }
   bool    setChar(uint8_t charID, int8_t   data8 ) { return this->setChar(charID, (uint8_t*) &data8, 1); }
 
@@ -57,8 +57,7 @@ SPISettings bluefruitSPI(4000000, MSBFIRST, SPI_MODE0);
     @param[in]  rstPin
 */
 /******************************************************************************/
-Adafruit_BluefruitLE_SPI::Adafruit_BluefruitLE_SPI(int8_t csPin, int8_t irqPin, int8_t rstPin) :
-    m_rx_fifo(m_rx_buffer, sizeof(m_rx_buffer), 1, true)
+Adafruit_BluefruitLE_SPI::Adafruit_BluefruitLE_SPI(int8_t csPin, int8_t irqPin, int8_t rstPin)
 {
   _physical_transport = BLUEFRUIT_TRANSPORT_HWSPI;
 
@@ -69,6 +68,8 @@ Adafruit_BluefruitLE_SPI::Adafruit_BluefruitLE_SPI(int8_t csPin, int8_t irqPin,
   m_miso_pin = m_mosi_pin = m_sck_pin = -1;
 
   m_tx_count = 0;
+  m_batch_depth = 0;
+  m_rx_fifo.reset();
 
   m_mode_switch_command_enabled = true;
 }
@@ -93,8 +94,7 @@ Adafruit_BluefruitLE_SPI::Adafruit_BluefruitLE_SPI(int8_t csPin, int8_t irqPin,
 */
 /******************************************************************************/
 Adafruit_BluefruitLE_SPI::Adafruit_BluefruitLE_SPI(int8_t clkPin, int8_t misoPin,
-    int8_t mosiPin, int8_t csPin, int8_t irqPin, int8_t rstPin) :
-    m_rx_fifo(m_rx_buffer, sizeof(m_rx_buffer), 1, true)
+    int8_t mosiPin, int8_t csPin, int8_t irqPin, int8_t rstPin)
 {
   _physical_transport = BLUEFRUIT_TRANSPORT_SWSPI;
 
@@ -106,6 +106,8 @@ Adafruit_BluefruitLE_SPI::Adafruit_BluefruitLE_SPI(int8_t clkPin, int8_t misoPin
   m_rst_pin  = rstPin;
 
   m_tx_count = 0;
+  m_batch_depth = 0;
+  m_rx_fifo.reset();
 
   m_mode_switch_command_enabled = true;
 }
@@ -193,8 +195,8 @@ void Adafruit_BluefruitLE_SPI::simulateSwitchMode(void)
   _mode = 1 - _mode;
 
   char ch = '0' + _mode;
-  m_rx_fifo.write(&ch);
-  m_rx_fifo.write_n("\r\nOK\r\n", 6);
+  m_rx_fifo.push(ch);
+  m_rx_fifo.push_n((uint8_t const*) "\r\nOK\r\n", 6);
 }
 
 /******************************************************************************/
@@ -270,9 +272,8 @@ bool Adafruit_BluefruitLE_SPI::sendPacket(uint16_t command, const uint8_t* buf,
   // Copy payload
   if ( buf != NULL && count > 0) memcpy(msgCmd.payload, buf, count);
 
-  // Starting SPI transaction
-  if (m_sck_pin == -1)
-    SPI.beginTransaction(bluefruitSPI);
+  // Starting SPI transaction, unless a batch already holds the bus
+  beginBatch();
 
   SPI_CS_ENABLE();
 
@@ -295,12 +296,47 @@ bool Adafruit_BluefruitLE_SPI::sendPacket(uint16_t command, const uint8_t* buf,
   }
 
   SPI_CS_DISABLE();
-  if (m_sck_pin == -1)
-    SPI.endTransaction();
+  endBatch();
 
   return result;
 }
 
+/******************************************************************************/
+/*!
+    @brief  Hold the SPI bus across several SDEP packets. CS is still
+            toggled for every packet, but the bus settings are applied once
+            for the whole batch instead of once per packet. Calls nest; the
+            bus is released when the outermost endBatch() is reached.
+*/
+/******************************************************************************/
+void Adafruit_BluefruitLE_SPI::beginBatch(void)
+{
+  if (m_batch_depth++ == 0 && m_sck_pin == -1)
+    SPI.beginTransaction(bluefruitSPI);
+}
+
+void Adafruit_BluefruitLE_SPI::endBatch(void)
+{
+  if (--m_batch_depth == 0 && m_sck_pin == -1)
+    SPI.endTransaction();
+}
+
+/******************************************************************************/
+/*!
+    @brief  Wait until the IRQ line reads the given level
+
+    @return 'true' if it did before the timer expired
+*/
+/******************************************************************************/
+bool Adafruit_BluefruitLE_SPI::waitForIRQ(bool level, TimeoutTimer& tt)
+{
+  while ( digitalRead(m_irq_pin) != level )
+  {
+    if ( tt.expired() ) return false;
+  }
+  return true;
+}
+
 /******************************************************************************/
 /*!
     @brief  Print API. Either buffer the data internally or send it to bus
@@ -375,6 +411,7 @@ size_t Adafruit_BluefruitLE_SPI::write(const uint8_t *buf, size_t size)
     }else
     {
       size_t remain = size;
+      beginBatch();
       while(remain)
       {
         size_t len = min(remain, SDEP_MAX_PACKETSIZE);
@@ -385,6 +422,7 @@ size_t Adafruit_BluefruitLE_SPI::write(const uint8_t *buf, size_t size)
       }
 
       getResponse();
+      endBatch();
     }
 
     return size;
@@ -400,6 +438,70 @@ size_t Adafruit_BluefruitLE_SPI::write(const uint8_t *buf, size_t size)
   }
 }
 
+/******************************************************************************/
+/*!
+    @brief  Send a complete command line straight out as SDEP packets, filling
+            each packet rather than buffering one character at a time.
+
+    @param[in]  line
+                Command text without the terminating newline
+*/
+/******************************************************************************/
+void Adafruit_BluefruitLE_SPI::writeCommandLine(const char line[], uint8_t len)
+{
+  // Fall back to the buffered path if a command is already part written
+  if (_mode == BLUEFRUIT_MODE_DATA || m_tx_count > 0)
+  {
+    Adafruit_BLE::writeCommandLine(line, len);
+    return;
+  }
+
+  if (_verbose) SerialDebug.write((uint8_t const*) line, len);
+
+  beginBatch();
+  while (len > SDEP_MAX_PACKETSIZE)
+  {
+    sendPacket(SDEP_CMDTYPE_AT_WRAPPER, (uint8_t const*) line, SDEP_MAX_PACKETSIZE, 1);
+    line += SDEP_MAX_PACKETSIZE;
+    len  -= SDEP_MAX_PACKETSIZE;
+  }
+  sendPacket(SDEP_CMDTYPE_AT_WRAPPER, (uint8_t const*) line, len, 0);
+  endBatch();
+}
+
+/******************************************************************************/
+/*!
+    @brief  Ask Bluefruit once for BLE UART data. Unlike readBLEUart(), this
+            makes a single UARTRX round trip and returns what it got instead
+            of polling until a read timeout expires, so it costs one short
+            SPI exchange whether or not data is waiting.
+
+    @param[in]  buffer
+                Where to copy the received bytes
+    @param[in]  size
+                Size of buffer; bytes beyond it are dropped
+
+    @return number of bytes copied to buffer
+*/
+/******************************************************************************/
+int Adafruit_BluefruitLE_SPI::pollBLEUart(uint8_t* buffer, int size)
+{
+  atcommand_finish();
+
+  // In COMMAND mode sendPacket() first clears any stale AT response out of
+  // the fifo. getResponse() then waits for IRQ, which the module raises as
+  // soon as its answer is ready.
+  if ( !sendPacket(SDEP_CMDTYPE_BLE_UARTRX, NULL, 0, 0) ) return 0;
+  getResponse();
+
+  int n = 0;
+  uint8_t ch;
+  while ( n < size && m_rx_fifo.pop(ch) ) buffer[n++] = ch;
+  m_rx_fifo.clear();
+
+  return n;
+}
+
 /******************************************************************************/
 /*!
     @brief Check if the response from the previous command is ready
@@ -441,7 +543,7 @@ int Adafruit_BluefruitLE_SPI::read(void)
 
   // try to grab from buffer first...
   if (!m_rx_fifo.empty()) {
-    m_rx_fifo.read(&ch);
+    m_rx_fifo.pop(ch);
     return (int)ch;
   }
 
@@ -458,7 +560,7 @@ int Adafruit_BluefruitLE_SPI::read(void)
     if ( digitalRead(m_irq_pin) ) getResponse();
   }
 
-  return m_rx_fifo.read(&ch) ? ((int) ch) : EOF;
+  return m_rx_fifo.pop(ch) ? ((int) ch) : EOF;
 
 }
 
@@ -475,7 +577,7 @@ int Adafruit_BluefruitLE_SPI::peek(void)
   uint8_t ch;
 
   // try to grab from buffer first...
-  if ( m_rx_fifo.peek(&ch) ) {
+  if ( m_rx_fifo.peek(ch) ) {
     return (int)ch;
   }
 
@@ -492,7 +594,7 @@ int Adafruit_BluefruitLE_SPI::peek(void)
     if ( digitalRead(m_irq_pin) ) getResponse();
   }
 
-  return m_rx_fifo.peek(&ch) ? ch : EOF;
+  return m_rx_fifo.peek(ch) ? ch : EOF;
 }
 
 /******************************************************************************/
@@ -521,30 +623,38 @@ void Adafruit_BluefruitLE_SPI::flush(void)
 /******************************************************************************/
 bool Adafruit_BluefruitLE_SPI::getResponse(void)
 {
+  bool result = true;
+
+  // All packets of the response share one SPI transaction
+  beginBatch();
+
   // Try to read data from Bluefruit if there is enough room in the fifo
-  while ( m_rx_fifo.remaining() >= SDEP_MAX_PACKETSIZE )
+  while ( m_rx_fifo.space() >= SDEP_MAX_PACKETSIZE )
   {
     // Get a SDEP packet
     sdepMsgResponse_t msg_response;
     memclr(&msg_response, sizeof(sdepMsgResponse_t));
 
-    if ( !getPacket(&msg_response) ) return false;
+    if ( !getPacket(&msg_response) )
+    {
+      result = false;
+      break;
+    }
 
     // Write to fifo
     if ( msg_response.header.length > 0)
     {
-      m_rx_fifo.write_n(msg_response.payload, msg_response.header.length);
+      m_rx_fifo.push_n(msg_response.payload, msg_response.header.length);
     }
 
     // No more packet data
     if ( !msg_response.header.more_data ) break;
 
-    // It takes a bit since all Data received to IRQ to get LOW
-    // May need to delay a bit for it to be stable before the next try
-    // delayMicroseconds(SPI_DEFAULT_DELAY_US);
+    // getPacket() waits for IRQ to come back up before the next packet
   }
 
-  return true;
+  endBatch();
+  return result;
 }
 
 /******************************************************************************/
@@ -563,14 +673,11 @@ bool Adafruit_BluefruitLE_SPI::getPacket(sdepMsgResponse_t* p_response)
   // Wait until IRQ is asserted, double timeout since some commands take long time to start responding
   TimeoutTimer tt(2*_timeout);
   
-  while ( !digitalRead(m_irq_pin) ) {
-    if (tt.expired()) return false;
-  }
+  if ( !waitForIRQ(HIGH, tt) ) return false;
   
   sdepMsgHeader_t* p_header = &p_response->header;
 
-  if (m_sck_pin == -1)
-    SPI.beginTransaction(bluefruitSPI);
+  beginBatch();
   SPI_CS_ENABLE();
 
   tt.set(_timeout);
@@ -594,16 +701,10 @@ bool Adafruit_BluefruitLE_SPI::getPacket(sdepMsgResponse_t* p_response)
       // This could happen when Arduino MCU is running at fast rate comparing to Bluefruit's MCU,
       // causing an SPI_OVERREAD_BYTE to be returned at stage.
       //
-      // Walkaround: Disable & Re-enable CS with a bit of delay and keep waiting
-      // TODO IRQ is supposed to be OFF then ON, it is better to use GPIO trigger interrupt.
-
+      // IRQ is still high from the last packet, so wait for it to drop and
+      // then be raised again for the next one rather than polling blind.
       SPI_CS_DISABLE();
-      // wait for the clock to be enabled..
-//      while (!digitalRead(m_irq_pin)) {
-//        if ( tt.expired() ) break;
-//      }
-//      if (!digitalRead(m_irq_pin)) break;
-      delayMicroseconds(SPI_DEFAULT_DELAY_US);
+      if ( !waitForIRQ(LOW, tt) || !waitForIRQ(HIGH, tt) ) break;
       SPI_CS_ENABLE();
     }
   }  while (p_header->msg_type == SPI_IGNORED_BYTE || p_header->msg_type == SPI_OVERREAD_BYTE);
@@ -650,8 +751,7 @@ bool Adafruit_BluefruitLE_SPI::getPacket(sdepMsgResponse_t* p_response)
   }while(0);
 
   SPI_CS_DISABLE();
-  if (m_sck_pin == -1)
-    SPI.endTransaction();
+  endBatch();
 
   return result;
 }
@@ -662,6 +762,12 @@ bool Adafruit_BluefruitLE_SPI::getPacket(sdepMsgResponse_t* p_response)
 */
 /******************************************************************************/
 void Adafruit_BluefruitLE_SPI::spixfer(void *buff, size_t len) {
+  if (m_sck_pin == -1) {
+    // hardware SPI moves the whole buffer in place in one call
+    SPI.transfer(buff, len);
+    return;
+  }
+
   uint8_t *p = (uint8_t *)buff;
 
   while (len--) {
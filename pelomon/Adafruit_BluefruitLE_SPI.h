@@ -38,7 +38,7 @@
 
 #include "Adafruit_BLE.h"
 #include <SPI.h>
-#include "utility/Adafruit_FIFO.h"
+#include "spsc_ring.h"
 
 #define SPI_CS_ENABLE()           digitalWrite(m_cs_pin, LOW)
 #define SPI_CS_DISABLE()          digitalWrite(m_cs_pin, HIGH)
@@ -67,9 +67,11 @@ class Adafruit_BluefruitLE_SPI : public Adafruit_BLE
     uint8_t         m_tx_buffer[SDEP_MAX_PACKETSIZE];
     uint8_t         m_tx_count;
 
+    // Nesting depth of beginBatch()
+    uint8_t         m_batch_depth;
+
     // RX
-    uint8_t         m_rx_buffer[BLE_BUFSIZE];
-    Adafruit_FIFO   m_rx_fifo;
+    SpscRing<uint8_t, BLE_BUFSIZE> m_rx_fifo;
 
     bool            m_mode_switch_command_enabled;
 
@@ -79,6 +81,9 @@ class Adafruit_BluefruitLE_SPI : public Adafruit_BLE
     bool    getPacket(sdepMsgResponse_t* p_response);
 
     bool    getResponse(void);
+    void    beginBatch(void);
+    void    endBatch(void);
+    bool    waitForIRQ(bool level, TimeoutTimer& tt);
     void    simulateSwitchMode(void);
 //    bool    handleSwitchCmdInDataMode(uint8_t ch);
 
@@ -104,6 +109,10 @@ class Adafruit_BluefruitLE_SPI : public Adafruit_BLE
     // pull in write(str) and write(buf, size) from Print
     using Print::write;
 
+    virtual void writeCommandLine(const char line[], uint8_t len);
+
+    int  pollBLEUart(uint8_t* buffer, int size);
+
     // Class Stream interface
     virtual int  available(void);
     virtual int  read(void);
@@ -11,6 +11,7 @@
 #ifndef BLE_CYCLING_GATT_H
 #define BLE_CYCLING_GATT_H
 #include <EEPROM.h>
+#include <util/crc16.h>
 #include "Adafruit_BLE.h"
 #include "Adafruit_BLEGatt.h"
 #include "ble_constants.h"
@@ -45,31 +46,54 @@ void string_comparator_callback(void* callback_data, char* linebuf, uint16_t lin
 
     const uint16_t next_pgm_line_len = strnlen_P(next_pgm_line, line_len+1);
     const int lines_matched = strncmp_P(linebuf, next_pgm_line, line_len);
-    if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
-        char logbuf[128];
+    if (LOG_ENABLED(LOG_LEVEL_DEBUG)) {
+        ScratchBuffer logbuf(128);
         Serial.print(F("Checking lines:\n\t"));
         Serial.println(linebuf);
         Serial.print('\t');
-        strncpy_P(logbuf, next_pgm_line, 128);
-        Serial.println(logbuf);
-        snprintf_P(logbuf, 32, PSTR("\tlengths: %d vs %d"), line_len, next_pgm_line_len);
-        Serial.println(logbuf);
-        snprintf_P(logbuf, 32, PSTR("\tstrcmp: %d"), lines_matched);
-        Serial.println(logbuf);
-        snprintf_P(logbuf, 32, PSTR("\tinitial matching %d"), state->is_equal ? 1 : 0);
-        Serial.println(logbuf);
+        strncpy_P(logbuf.data, next_pgm_line, logbuf.len);
+        logbuf.data[logbuf.len - 1] = '\0';
+        Serial.println(logbuf.data);
+        snprintf_P(logbuf.data, logbuf.len, PSTR("\tlengths: %d vs %d"), line_len, next_pgm_line_len);
+        Serial.println(logbuf.data);
+        snprintf_P(logbuf.data, logbuf.len, PSTR("\tstrcmp: %d"), lines_matched);
+        Serial.println(logbuf.data);
+        snprintf_P(logbuf.data, logbuf.len, PSTR("\tinitial matching %d"), state->is_equal ? 1 : 0);
+        Serial.println(logbuf.data);
     }
     state->is_equal = (state->is_equal && (line_len == next_pgm_line_len) && (0 == lines_matched));
     state->line_number++;
-    if (LOG_LEVEL >= LOG_LEVEL_DEBUG)
+    if (LOG_ENABLED(LOG_LEVEL_DEBUG))
     {
-        char logbuf[128];
-        snprintf_P(logbuf, 32, PSTR("\tfinal matching %d"), state->is_equal ? 1 : 0);
-        Serial.println(logbuf);
+        ScratchBuffer logbuf(32);
+        snprintf_P(logbuf.data, logbuf.len, PSTR("\tfinal matching %d"), state->is_equal ? 1 : 0);
+        Serial.println(logbuf.data);
     }
 }
 
 
+/* The module keeps its GATT table in flash across resets. After building
+ * the table we store a CRC of the module's AT+GATTLIST listing; a later
+ * boot that lists the same table can reuse the stored IDs as they are.
+ * Bump the layout version whenever the services below change.
+ */
+#define BLE_GATT_LAYOUT_VERSION 2
+#define BLE_GATTLIST_LINE_LEN 64
+
+void hash_callback(void* callback_data, char* linebuf, uint16_t line_len)
+{
+    ProgmemComparatorState* state = (ProgmemComparatorState*) callback_data;
+    // Hash mode: one running CRC over every line, in place of a table
+    uint16_t* hash = (uint16_t*) (state->pgm_entry_table);
+    // Only the layout counts, not what the characteristics hold now
+    const char* value = strstr_P(linebuf, PSTR("VALUE="));
+    if (value) line_len = value - linebuf;
+    for (uint16_t i = 0; i < line_len; i++) *hash = _crc_ccitt_update(*hash, linebuf[i]);
+    *hash = _crc_ccitt_update(*hash, '\n');
+    state->line_number++;
+}
+
+
 void logging_callback(void* callback_data, char* linebuf, uint16_t line_len)
 {
     char logbuf[32];
@@ -80,10 +104,52 @@ void logging_callback(void* callback_data, char* linebuf, uint16_t line_len)
 }
 
 
+#define NOTIFY_PAYLOAD_MAXLEN 15
+
+struct NotifyState
+{
+    uint8_t payload[NOTIFY_PAYLOAD_MAXLEN];
+    uint8_t sent[NOTIFY_PAYLOAD_MAXLEN];
+    uint8_t len;
+    bool ever_sent;
+    unsigned long last_sent_ms;
+    // When the readings in payload and in sent were taken
+    unsigned long staged_sample_ms;
+    unsigned long sent_sample_ms;
+
+    // Notify as soon as the value changes (rate limited), and re-send
+    // an unchanged value as a heartbeat only while the ride is active.
+    // The rate limit runs from when the last notified reading was taken,
+    // so a late send doesn't hold back the next one; sends are still
+    // never closer than half the interval.
+    bool due(const unsigned long now, const bool active) const
+    {
+        if (len == 0) return false;
+        const unsigned long since = now - last_sent_ms;
+        const bool changed = !ever_sent || memcmp(payload, sent, len) != 0;
+        if (changed) return now - sent_sample_ms >= BT_MIN_NOTIFY_INTERVAL_MILLIS &&
+                            since >= BT_MIN_NOTIFY_INTERVAL_MILLIS / 2;
+        return active && since >= BT_HEARTBEAT_INTERVAL_MILLIS;
+    }
+    void mark_sent(const unsigned long now)
+    {
+        memcpy(sent, payload, len);
+        ever_sent = true;
+        last_sent_ms = now;
+        sent_sample_ms = staged_sample_ms;
+    }
+    void mark_failed(const unsigned long now)
+    {
+        // Still due, but retried no sooner than the rate limit allows
+        last_sent_ms = now;
+    }
+};
+
 class BLECyclingPower
 {
-    // Exposes both the Cycling Power and the Cycling Speed and Cadence
-    // Features
+    // Exposes the Fitness Machine Service's Indoor Bike Data and,
+    // unless configured for FTMS only, the Cycling Power and the Cycling
+    // Speed and Cadence Features
     private:
     Adafruit_BLE& ble_;
     Adafruit_BLEGatt gatt_;
@@ -101,26 +167,195 @@ class BLECyclingPower
     uint8_t csc_sensor_location_id;
     uint8_t sc_control_point_id;
 
+    uint8_t ftms_service_id;
+    uint8_t ftms_feature_id;
+    uint8_t ftms_data_id;
+
+    // BLE_SERVICES_FTMS_ONLY or BLE_SERVICES_ALL
+    uint8_t services;
+
+    GattCharPrefix cp_measurement_cmd;
+    GattCharPrefix csc_measurement_cmd;
+    GattCharPrefix ftms_data_cmd;
+
+    // Latest measurements staged by update(), and what each
+    // characteristic was last notified with.
+    NotifyState cp_state;
+    NotifyState csc_state;
+    NotifyState ftms_state;
+    uint8_t next_notify;
+    uint16_t notify_errors;
+    bool warm_boot;
+
     public:
-    BLECyclingPower(Adafruit_BLE& ble, Logger& logger_): ble_(ble), gatt_(ble), logger(logger_) {};
+    BLECyclingPower(Adafruit_BLE& ble, Logger& logger_): ble_(ble), gatt_(ble), logger(logger_),
+                                                         notify_errors(0), warm_boot(false) {};
+
+    bool cycling_services() const
+    {
+        return services == BLE_SERVICES_ALL;
+    }
+
+    static uint8_t stored_services()
+    {
+        const uint8_t stored = EEPROM.read(EEPROM_BLE_SERVICES_ADDRESS);
+        if (stored == BLE_SERVICES_FTMS_ONLY || stored == BLE_SERVICES_ALL) return stored;
+        return BLE_SERVICES_DEFAULT;
+    }
+
+    static void store_services(const uint8_t services_)
+    {
+        // Takes effect at the next boot, which rebuilds the GATT table
+        EEPROM.update(EEPROM_BLE_SERVICES_ADDRESS, services_);
+    }
 
 
     void initialize()
     {
-        // Software reset module on bringup
-        ble_.reset();
-        
+        // begin() may have left the module rebooting in the background
+        while (!ble_.resetCompleted());
+
         //Disable command echo from Bluefruit
         ble_.echo(false);
 
+        services = stored_services();
+        warm_boot = load_gatt_ids() && gatt_table_hash() == stored_gatt_hash();
+        if (warm_boot) {
+            LOG_PRINT(LOG_LEVEL_INFO, F("BLE GATT table intact\n"));
+        } else {
+            configure_gatt();
+        }
+
+        if (LOG_ENABLED(LOG_LEVEL_DEBUG)) {
+            logger.print(F("Checking GATTs\n"));
+            ble_.sendCommandCheckOK(F("AT+GATTLIST"));
+        }
+        
+        // Set up initial values for feature and sensor location
+        if (cycling_services()) {
+            gatt_.setChar(cp_sensor_location_id, SENSOR_LOCATION_LEFT_CRANK);
+            gatt_.setChar(csc_sensor_location_id, SENSOR_LOCATION_LEFT_CRANK);
+
+            gatt_.setChar(cp_feature_id,
+                          (uint32_t) (CPF_CRANK_REVOLUTION_DATA_SUPPORTED |
+                                      CPF_WHEEL_REVOLUTION_DATA_SUPPORTED |
+                                      CPF_ACCUMULATED_ENERGY_SUPPORTED));
+            gatt_.setChar(csc_feature_id,
+                          (uint16_t) (CSCF_CRANK_REVOLUTION_DATA_SUPPORTED |
+                                      CSCF_WHEEL_REVOLUTION_DATA_SUPPORTED));
+            const uint8_t zero = 0;
+            gatt_.setChar(sc_control_point_id, &zero, 1);
+        }
+
+        // Fitness Machine Features, then Target Setting Features: none,
+        // since the bike can't be controlled
+        uint8_t ftms_features[8];
+        uint8_t base = 0;
+        const uint32_t machine_features = FMF_CADENCE_SUPPORTED |
+                                          FMF_RESISTANCE_LEVEL_SUPPORTED |
+                                          FMF_EXPENDED_ENERGY_SUPPORTED |
+                                          FMF_POWER_MEASUREMENT_SUPPORTED;
+        const uint32_t target_features = 0;
+        APPEND_BUFFER(ftms_features, base, machine_features);
+        APPEND_BUFFER(ftms_features, base, target_features);
+        gatt_.setChar(ftms_feature_id, ftms_features, base);
+
+        // Measurements are written on every update; format their
+        // command prefixes once
+        if (cycling_services()) {
+            gatt_.prepareChar(cp_measurement_cmd, cp_measurement_id);
+            gatt_.prepareChar(csc_measurement_cmd, csc_measurement_id);
+        }
+        gatt_.prepareChar(ftms_data_cmd, ftms_data_id);
+        memset(&cp_state, 0, sizeof(cp_state));
+        memset(&csc_state, 0, sizeof(csc_state));
+        memset(&ftms_state, 0, sizeof(ftms_state));
+        next_notify = 0;
+        return;
+    }
+
+    uint16_t gatt_table_hash()
+    {
+        char linebuf[BLE_GATTLIST_LINE_LEN];
+        // Switching services must not look like an intact table
+        uint16_t hash = BLE_GATT_LAYOUT_VERSION ^ ((uint16_t) services << 8);
+        ProgmemComparatorState state = {true, 0, 0, &hash};
+        ble_.atcommandStrReplyPerLine(F("AT+GATTLIST"), linebuf, BLE_GATTLIST_LINE_LEN,
+                                      BLE_DEFAULT_TIMEOUT, hash_callback, &state);
+        // An empty table never matches
+        return state.line_number ? hash : 0;
+    }
+
+    uint16_t stored_gatt_hash() const
+    {
+        return (EEPROM.read(EEPROM_BLE_GATT_HASH_ADDRESS + 1) << 8) |
+               EEPROM.read(EEPROM_BLE_GATT_HASH_ADDRESS);
+    }
+
+    static bool load_id_group(uint8_t* const* ids, const uint8_t count,
+                              const uint16_t address)
+    {
+        bool valid = true;
+        for (uint8_t i = 0; i < count; i++) {
+            *ids[i] = EEPROM.read(address + i);
+            // Zero is a failed add; 0xFF is blank EEPROM
+            if (*ids[i] == 0 || *ids[i] == 0xFF) valid = false;
+        }
+        return valid;
+    }
+
+    static void store_id_group(const uint8_t* ids, const uint8_t count,
+                               const uint16_t address)
+    {
+        for (uint8_t i = 0; i < count; i++) EEPROM.update(address + i, ids[i]);
+    }
+
+    bool load_gatt_ids()
+    {
+        // Stored in the same order as the members. CP/CSC IDs are only
+        // checked when those services are in the table.
+        uint8_t* const cycling_ids[] = {&cp_service_id, &cp_feature_id, &cp_measurement_id,
+                                        &cp_sensor_location_id, &csc_service_id,
+                                        &csc_feature_id, &csc_measurement_id,
+                                        &csc_sensor_location_id, &sc_control_point_id};
+        uint8_t* const ftms_ids[] = {&ftms_service_id, &ftms_feature_id, &ftms_data_id};
+        bool valid = load_id_group(ftms_ids, sizeof(ftms_ids) / sizeof(ftms_ids[0]),
+                                   EEPROM_BLE_FTMS_SERVICE_ID_ADDRESS);
+        if (cycling_services()) {
+            valid &= load_id_group(cycling_ids, sizeof(cycling_ids) / sizeof(cycling_ids[0]),
+                                   EEPROM_BLE_CP_SERVICE_ID_ADDRESS);
+        }
+        return valid;
+    }
+
+    void store_gatt_ids(const uint16_t hash)
+    {
+        const uint8_t cycling_ids[] = {cp_service_id, cp_feature_id, cp_measurement_id,
+                                       cp_sensor_location_id, csc_service_id, csc_feature_id,
+                                       csc_measurement_id, csc_sensor_location_id,
+                                       sc_control_point_id};
+        const uint8_t ftms_ids[] = {ftms_service_id, ftms_feature_id, ftms_data_id};
+        if (cycling_services()) {
+            store_id_group(cycling_ids, sizeof(cycling_ids), EEPROM_BLE_CP_SERVICE_ID_ADDRESS);
+        }
+        store_id_group(ftms_ids, sizeof(ftms_ids), EEPROM_BLE_FTMS_SERVICE_ID_ADDRESS);
+        EEPROM.update(EEPROM_BLE_GATT_HASH_ADDRESS, hash & 0xFF);
+        EEPROM.update(EEPROM_BLE_GATT_HASH_ADDRESS + 1, hash >> 8);
+    }
+
+    void configure_gatt()
+    {
         ble_.atcommand(F("AT+GATTCLEAR"));
         
         // Set up advertising data and name
         ble_.sendCommandCheckOK(F("AT+GAPDEVNAME=PeloMon"));
 
         
-        setup_cycling_power_feature();
-        setup_cycling_speed_cadence_feature();
+        if (cycling_services()) {
+            setup_cycling_power_feature();
+            setup_cycling_speed_cadence_feature();
+        }
+        setup_fitness_machine_feature();
 
                 
         /* Advertising data:
@@ -132,35 +367,26 @@ class BLECyclingPower
             05 02 18 18 16 18  16-bit service UUIDs
                                  0x1818 (CYCLING POWER SERVICE)
                                  0x1816 (CYCLING SPEED/CADENCE SERVICE)
+            07 02 18 18 16 18 26 18
+                               ... and 0x1826 (FITNESS MACHINE SERVICE)
+        With all three services, Tx power is dropped to stay within the
+        31 byte advertising payload.
         */
 
        
         //ble_.sendCommandCheckOK(F("AT+GAPSETADVDATA=02-01-06-05-02-18-18-0a-18"));
         //ble_.sendCommandCheckOK(F("AT+GAPSETADVDATA=02-01-06-05-02-18-18-0a-18"));
         //ble_.sendCommandCheckOK(F("AT+GAPSETADVDATA=02-01-06-02-0a-00-11-06-9e-ca-dc-24-0e-e5-a9-e0-93-f3-a3-b5-01-00-40-6e-05-02-18-18-16-18"));
-        ble_.sendCommandCheckOK(F("AT+GAPSETADVDATA=02-01-06-02-0a-00-11-06-9e-ca-dc-24-0e-e5-a9-e0-93-f3-a3-b5-01-00-40-6e-05-02-18-18-16-18"));
+        if (cycling_services()) {
+            ble_.sendCommandCheckOK(F("AT+GAPSETADVDATA=02-01-06-11-06-9e-ca-dc-24-0e-e5-a9-e0-93-f3-a3-b5-01-00-40-6e-07-02-18-18-16-18-26-18"));
+        } else {
+            ble_.sendCommandCheckOK(F("AT+GAPSETADVDATA=02-01-06-02-0a-00-11-06-9e-ca-dc-24-0e-e5-a9-e0-93-f3-a3-b5-01-00-40-6e-03-02-26-18"));
+        }
 
+        // New services only take effect after a reset
         ble_.reset();
-
-        if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
-            logger.print(F("Checking GATTs\n"));
-            ble_.sendCommandCheckOK(F("AT+GATTLIST"));
-        }
-        
-        // Set up initial values for feature and sensor location
-        gatt_.setChar(cp_sensor_location_id, SENSOR_LOCATION_LEFT_CRANK);
-        gatt_.setChar(csc_sensor_location_id, SENSOR_LOCATION_LEFT_CRANK);
-
-        gatt_.setChar(cp_feature_id,
-                      (uint32_t) (CPF_CRANK_REVOLUTION_DATA_SUPPORTED |
-                                  CPF_WHEEL_REVOLUTION_DATA_SUPPORTED |
-                                  CPF_ACCUMULATED_ENERGY_SUPPORTED));
-        gatt_.setChar(csc_feature_id,
-                      (uint16_t) (CSCF_CRANK_REVOLUTION_DATA_SUPPORTED |
-                                  CSCF_WHEEL_REVOLUTION_DATA_SUPPORTED));
-        const uint8_t zero = 0;
-        gatt_.setChar(sc_control_point_id, &zero, 1);
-        return;
+        ble_.echo(false);
+        store_gatt_ids(gatt_table_hash());
     }
 
 
@@ -243,16 +469,95 @@ class BLECyclingPower
     }
 
 
-    bool update(const uint16_t crank_revs, const uint32_t last_crank_rev_timestamp_ms, const uint32_t wheel_revs, const uint32_t last_wheel_rev_timestamp_ms, uint16_t power_watts, const uint16_t total_energy_kj)
+    void setup_fitness_machine_feature()
     {
-      uint8_t data[11] = {0};
-      uint8_t base;
-      const bool update_cp = true;
-      const bool update_csc = true;
-      bool cpm_success = true;
-      bool csc_success = true;
-      if (update_cp)
+      //FITNESS_MACHINE_SERVICE_UUID
+      ftms_service_id = gatt_.addService(FITNESS_MACHINE_SERVICE_UUID);
+      if (!ftms_service_id)
+      {
+        logger.println(F("Could not add the service FITNESS_MACHINE_SERVICE_UUID"));
+      }
+
+      //FITNESS_MACHINE_FEATURE_CHAR_UUID
+      ftms_feature_id = gatt_.addCharacteristic(FITNESS_MACHINE_FEATURE_CHAR_UUID,GATT_CHARS_PROPERTIES_READ,8,8,BLE_DATATYPE_AUTO);
+      if (!ftms_feature_id)
+      {
+        logger.println(F("Could not add the characteristic FITNESS_MACHINE_FEATURE_CHAR_UUID"));
+      }
+
+      // Indoor Bike Data
+      ftms_data_id = gatt_.addCharacteristic(INDOOR_BIKE_DATA_CHAR_UUID,GATT_CHARS_PROPERTIES_NOTIFY,2,NOTIFY_PAYLOAD_MAXLEN,BLE_DATATYPE_AUTO);
+      if (!ftms_data_id)
       {
+        logger.println(F("Could not add the characteristic INDOOR_BIKE_DATA_CHAR_UUID"));
+      }
+    }
+
+
+    bool update(const uint16_t crank_revs, const uint32_t last_crank_rev_timestamp_ms, const uint32_t wheel_revs, const uint32_t last_wheel_rev_timestamp_ms, uint16_t power_watts, const uint16_t total_energy_kj, const uint16_t workout_energy_kj, const uint16_t cadence_rpm, const uint16_t speed_cmph, const uint8_t resistance, const unsigned long sample_ms)
+    {
+      // Stage new values; service() notifies whichever have changed
+      cp_state.staged_sample_ms = csc_state.staged_sample_ms = ftms_state.staged_sample_ms = sample_ms;
+      if (cycling_services()) {
+        stage_cp_measurement(power_watts, total_energy_kj);
+        stage_csc_measurement(crank_revs, last_crank_rev_timestamp_ms,
+                              wheel_revs, last_wheel_rev_timestamp_ms);
+        handle_sc_control_point();
+      }
+      stage_indoor_bike_data(speed_cmph, cadence_rpm, resistance, power_watts, workout_energy_kj);
+      return true;
+    }
+
+    void stage_indoor_bike_data(const uint16_t speed_cmph, const uint16_t cadence_rpm,
+                                const uint8_t resistance, uint16_t power_watts,
+                                const uint16_t workout_energy_kj)
+    {
+        // Indoor Bike Data format specified in
+        // https://github.com/oesmith/gatt-xml/blob/master/org.bluetooth.characteristic.indoor_bike_data.xml
+        // Fields follow the flags in bit order.
+        uint8_t base = 0;
+        // More Data clear: instantaneous speed is present
+        uint16_t flags = (IBD_INSTANTANEOUS_CADENCE_PRESENT |
+                          IBD_INSTANTANEOUS_POWER_PRESENT |
+                          IBD_EXPENDED_ENERGY_PRESENT);
+        // Resistance is unknown until the LUT has been read
+        if (resistance != 0xFF) flags |= IBD_RESISTANCE_LEVEL_PRESENT;
+        APPEND_BUFFER(ftms_state.payload, base, flags);
+
+        // Instantaneous speed: uint16 in 0.01 km/h
+        // 1 mph = 1.609344 km/h; 103/64 = 1.609375
+        const uint16_t speed_kmph_hundredths = ((uint32_t) speed_cmph * 103) >> 6;
+        APPEND_BUFFER(ftms_state.payload, base, speed_kmph_hundredths);
+
+        // Instantaneous cadence: uint16 in 0.5 rpm
+        const uint16_t cadence_half_rpm = cadence_rpm << 1;
+        APPEND_BUFFER(ftms_state.payload, base, cadence_half_rpm);
+
+        // Resistance level: sint16, unitless; the Peloton 0-100 scale
+        if (flags & IBD_RESISTANCE_LEVEL_PRESENT) {
+            const int16_t resistance_level = resistance;
+            APPEND_BUFFER(ftms_state.payload, base, resistance_level);
+        }
+
+        // Instantaneous power: sint16 in Watts
+        if (power_watts > 0x7FFF) power_watts = 0x7FFF;
+        APPEND_BUFFER(ftms_state.payload, base, power_watts);
+
+        // Total energy: uint16 in kcal. Reported as the kJ of mechanical
+        // work, as bike computers do: at ~24% efficiency one kJ of work
+        // burns about one kcal. Per workout, unlike the CP total.
+        APPEND_BUFFER(ftms_state.payload, base, workout_energy_kj);
+        // Energy per hour and per minute are required with total energy
+        const uint16_t energy_per_hour = IBD_ENERGY_NOT_AVAILABLE_16;
+        APPEND_BUFFER(ftms_state.payload, base, energy_per_hour);
+        const uint8_t energy_per_minute = IBD_ENERGY_NOT_AVAILABLE_8;
+        APPEND_BUFFER(ftms_state.payload, base, energy_per_minute);
+
+        ftms_state.len = base;
+    }
+
+    void stage_cp_measurement(uint16_t power_watts, const uint16_t total_energy_kj)
+    {
         // CP Measurement format specified in
         // https://github.com/oesmith/gatt-xml/blob/master/org.bluetooth.characteristic.cycling_power_measurement.xml
 
@@ -264,54 +569,94 @@ class BLECyclingPower
          * time resolution.
          */
 
-        base = 0;
+        uint8_t base = 0;
         // flags: mandatory, 16 bit bitfield
         uint16_t flags = (CPM_ACCUMULATED_ENERGY_PRESENT);
-        APPEND_BUFFER(data, base, flags);
+        APPEND_BUFFER(cp_state.payload, base, flags);
 
         // Instantaneous power: mandatory sint16 in Watts
         // Clamp the uint16 input to avoid overflowing the sint16 expected by BT spec
         if (power_watts > 0x7FFF) power_watts = 0x7FFF;
-        APPEND_BUFFER(data, base, power_watts);
+        APPEND_BUFFER(cp_state.payload, base, power_watts);
 
         // 3.2.1.12 accumulated energy is in kJ uint16
-        APPEND_BUFFER(data, base, total_energy_kj);
-
-        cpm_success = gatt_.setChar(cp_measurement_id, data, base);
-      }
+        APPEND_BUFFER(cp_state.payload, base, total_energy_kj);
 
+        cp_state.len = base;
+    }
 
-      if (update_csc)
-      {
+    void stage_csc_measurement(const uint16_t crank_revs, const uint32_t last_crank_rev_timestamp_ms, const uint32_t wheel_revs, const uint32_t last_wheel_rev_timestamp_ms)
+    {
         // Set up the CSC measurement with wheel and crank revs.
         // https://github.com/oesmith/gatt-xml/blob/master/
         // org.bluetooth.characteristic.csc_measurement.xml
-        base = 0;
+        uint8_t base = 0;
         // Flags: uint8
         uint8_t csc_flags = (CSCM_WHEEL_REV_DATA_PRESENT | CSCM_CRANK_REV_DATA_PRESENT);
-        APPEND_BUFFER(data, base, csc_flags);
+        APPEND_BUFFER(csc_state.payload, base, csc_flags);
 
         // Cumulative wheel revs uint32
-        APPEND_BUFFER(data, base, wheel_revs);
+        APPEND_BUFFER(csc_state.payload, base, wheel_revs);
         // Last wheel rev event time: uint16, 1/1024s resolution
         // NB! Time resolution for wheel revs is lower in CSC than in CP!
         // CP would expect 1/2048.
         uint16_t last_wheel_event_time_csc = \
                 (uint16_t) ((last_wheel_rev_timestamp_ms * 128) / 125);
-        APPEND_BUFFER(data, base, last_wheel_event_time_csc);
+        APPEND_BUFFER(csc_state.payload, base, last_wheel_event_time_csc);
 
         // Cumulative crank revs uint16
-        APPEND_BUFFER(data, base, crank_revs);
+        APPEND_BUFFER(csc_state.payload, base, crank_revs);
         // Last Crank event time uint16 in 1/1024s units
         uint16_t last_crank_event_time = \
                 (uint16_t) ((last_crank_rev_timestamp_ms * 128) / 125);
-        APPEND_BUFFER(data, base, last_crank_event_time);
+        APPEND_BUFFER(csc_state.payload, base, last_crank_event_time);
 
-        csc_success = gatt_.setChar(csc_measurement_id, data, base);
-      }
+        csc_state.len = base;
+    }
 
-      handle_sc_control_point();
-      return cpm_success && csc_success;
+    void service(const bool ride_active)
+    {
+        // Advance the notification pipeline by one step: collect the
+        // module's response to the last write if it's ready, then send
+        // whichever measurement is due. Never waits on the module.
+        if (ble_.atcommand_pending()) {
+            const uint8_t status = ble_.atcommand_poll();
+            if (status == AT_ASYNC_PENDING) return;
+            if (status == AT_ASYNC_ERROR) notify_errors++;
+        }
+        const unsigned long now = millis();
+        // Round robin, so a busy characteristic can't starve the others
+        NotifyState* const states[] = {&ftms_state, &cp_state, &csc_state};
+        GattCharPrefix* const cmds[] = {&ftms_data_cmd, &cp_measurement_cmd,
+                                        &csc_measurement_cmd};
+        for (uint8_t i = 0; i < 3; i++) {
+            const uint8_t which = next_notify;
+            next_notify = next_notify == 2 ? 0 : next_notify + 1;
+            if (!states[which]->due(now, ride_active)) continue;
+            if (gatt_.setCharBegin(*cmds[which], states[which]->payload, states[which]->len)) {
+                states[which]->mark_sent(now);
+            } else {
+                notify_errors++;
+                states[which]->mark_failed(now);
+            }
+            return;
+        }
+    }
+
+    uint16_t notify_error_count() const
+    {
+        // Writes the module refused or answered with ERROR
+        return notify_errors;
+    }
+
+    void set_low_power(const bool low_power)
+    {
+        // Slower advertising and connection events while nobody is riding
+        if (low_power) {
+            ble_.sendCommandCheckOK(F("AT+GAPINTERVALS=" BLE_GAP_INTERVALS_IDLE));
+        } else {
+            ble_.sendCommandCheckOK(F("AT+GAPINTERVALS=" BLE_GAP_INTERVALS_ACTIVE));
+        }
     }
 
     void handle_sc_control_point()
@@ -338,6 +683,17 @@ class BLECyclingPower
         logger.print(buf);
         snprintf_P(buf, 40, PSTR("\t\t% 3hhu  % 3hhu  % 3hhu  % 4hhu\n"), csc_service_id, csc_feature_id, csc_measurement_id, csc_sensor_location_id);
         logger.print(buf);
+        strcpy_P(buf, PSTR("\t\tFTMS SERVICE\n\t\tsid  fid  did\n"));
+        logger.print(buf);
+        snprintf_P(buf, 40, PSTR("\t\t% 3hhu  % 3hhu  % 3hhu\n"), ftms_service_id, ftms_feature_id, ftms_data_id);
+        logger.print(buf);
+        if (cycling_services()) strcpy_P(buf, PSTR("\t\tservices: FTMS+CP+CSC\n"));
+        else strcpy_P(buf, PSTR("\t\tservices: FTMS\n"));
+        logger.print(buf);
+        snprintf_P(buf, 40, PSTR("\t\twarm boot: %d\n"), (int) warm_boot);
+        logger.print(buf);
+        snprintf_P(buf, 40, PSTR("\t\tnotify errors: %u\n"), notify_errors);
+        logger.print(buf);
     }
 };
 
@@ -8,93 +8,101 @@
  * Licensed under the CC-BY-NC 4.0 license
  * (https://creativecommons.org/licenses/by-nc/4.0/).
  */
+// Fixed-point units: rates are in micro-revolutions per ms, energy in
+// deciwatt-milliseconds. 1e6 urev = 1 rev and 1e7 dW*ms = 1 kJ.
+#define UREV_PER_REV 1000000UL
+#define DECIWATTMS_PER_KJ 10000000UL
+
+/* Cumulative totals that survive a reset, via RideLog.
+ */
+struct RideTotals {
+    uint32_t energy_kj;
+    uint32_t crank_revs;
+    uint32_t wheel_revs;
+};
+
+/* Revolution counter with exact integer accumulation: whole revs plus
+ * the partial rev in urev, so nothing is lost however long the ride.
+ */
+struct RevCounter {
+    uint32_t revs;
+    uint32_t partial_urevs;
+    unsigned long event_ts;     // time of the last completed revolution
+
+    void reset(const unsigned long ts) {
+        revs = partial_urevs = 0;
+        event_ts = ts;
+    }
+    void advance(const uint32_t urev_per_ms, const unsigned long elapsed_ms,
+                 const unsigned long ts) {
+        partial_urevs += urev_per_ms * elapsed_ms;
+        if (partial_urevs < UREV_PER_REV) return;
+        // Had at least one completed revolution event this time.
+        // Need to compute how many ms back we last ticked over a rev
+        while (partial_urevs >= UREV_PER_REV) {
+            partial_urevs -= UREV_PER_REV;
+            revs++;
+        }
+        event_ts = ts - partial_urevs / urev_per_ms;
+    }
+    uint16_t hundredths() const {
+        return partial_urevs / (UREV_PER_REV / 100);
+    }
+};
+
 class RideStatus {
     private:
     Logger& logger;
     unsigned long last_rpm_timestamp;
     unsigned long last_power_timestamp;
-    unsigned long last_crank_rev_timestamp;
-    unsigned long last_wheel_rev_timestamp;
-    float total_crank_revolutions;
-    float total_wheel_revolutions;
-    float total_energy_kj;
-    float current_mph;
+    RevCounter crank;
+    RevCounter wheel;
+    uint32_t total_energy_kj;
+    uint32_t partial_energy_deciwattms;
+    uint32_t workout_start_kj;  // total_energy_kj when this workout began
+    uint16_t current_cmph;      // hundredths of a mph
     uint16_t current_rpm;
     uint16_t current_power_deciwatt;
     uint16_t current_raw_resistance;
     uint8_t current_resistance;
 
-    void update_revs_and_time(float& total_revs, unsigned long& event_ts,
-                              const float incremental_revs, const float rev_per_ms,
-                              const unsigned long ts) {
-        const int previous_int_revs = (int) total_revs;
-        total_revs += incremental_revs;
-        const int integral_revs = (int) total_revs;
-        if (previous_int_revs != integral_revs) {
-            // Had at least one completed revolution event this time.
-            // Need to compute how many ms back we last ticked over a rev
-            float partial_revs = total_revs - integral_revs;
-            float ms_since_last_cplt_rev = partial_revs / rev_per_ms;
-            event_ts = ts - (unsigned long) ms_since_last_cplt_rev;
-        }
-        return;
-    }
-    float mph_from_power(const uint16_t power_deciwatts) const {
-        // Derived from piecewise polynomial regression on a dataset of
-        // about 150 rides. Regression done on watts but bike provides
-        // watts * 10.
-        const float power = ((float) power_deciwatts) * 0.1f;
-        const float rtpower = sqrt(power);
-        const float coefs_low[4] = {-0.07605, 0.74063, -0.14023, 0.04660};
-        const float coefs_high[4] = {0.00087, -0.05685, 2.23594, -1.31158};
-        const float* const coefs = power < 27.0f ? coefs_low : coefs_high;
-        float mph = 0;
-        for (uint8_t i=0; i < 3; i++) {
-            mph += coefs[i];
-            mph *= rtpower;
-        }
-        mph += coefs[3];
-        return mph;
-    }
-
     void update_new_rpm(const uint16_t new_rpm) {
         /* Update rpm and total crank revs since last rpm message.
          */
         const unsigned long ts = millis();
-        if (last_rpm_timestamp == 0 || (ts - last_rpm_timestamp) > 5000) {
-            // Reset our counter if we never saw data or saw it >5s ago
-            last_rpm_timestamp = last_crank_rev_timestamp = ts;
-            total_crank_revolutions = 0.0f;
-        } 
+        if (last_rpm_timestamp == 0) crank.event_ts = ts;
+        if (last_rpm_timestamp == 0 || (ts - last_rpm_timestamp) > RIDE_IDLE_TIMEOUT_MILLIS) {
+            // Don't integrate over a gap of >5s; the totals carry on
+            last_rpm_timestamp = ts;
+        }
         const unsigned long elapsed_ms = ts - last_rpm_timestamp;
         current_rpm = new_rpm;
         last_rpm_timestamp = ts;
-        const float rpmsec_per_rpm = 1.0f / 60000.0f;
-        const float rpmsec = rpmsec_per_rpm * current_rpm;
-        const float increm_crank_revs = rpmsec * elapsed_ms;
-        update_revs_and_time(total_crank_revolutions, last_crank_rev_timestamp,
-                             increm_crank_revs, rpmsec, ts);
-        if (total_crank_revolutions > 16777215.0f) {
-             // Prevent FP32 loss of precision
-             // It is ok for crank revolutions to roll over
-             total_crank_revolutions -= (unsigned long) total_crank_revolutions;
-        }
+        /* 1 rpm = 1e6 urev / 60000 ms = 16.667 urev/ms
+         * 16.667 * 1024 = 17067
+         */
+        const uint32_t urev_per_ms = ((uint32_t) current_rpm * 17067) >> 10;
+        // Crank revolutions are allowed to roll over at 16 bits
+        crank.advance(urev_per_ms, elapsed_ms, ts);
     }
     void update_new_power(const uint16_t new_power_deciwatts) {
         /* Update power, accumulated energy, current speed,
          * and total wheel revolutions since last power message.
          */
         const unsigned long ts = millis();
-        if (last_power_timestamp == 0 || (ts - last_power_timestamp) > 5000) {
-            // Reset our counter if we never saw data or saw it >5s ago
-            last_power_timestamp = last_wheel_rev_timestamp = ts;
-            total_energy_kj = total_wheel_revolutions = 0.0f;
+        if (last_power_timestamp == 0) wheel.event_ts = ts;
+        else if (ts - last_power_timestamp > WORKOUT_GAP_MILLIS) workout_start_kj = total_energy_kj;
+        if (last_power_timestamp == 0 || (ts - last_power_timestamp) > RIDE_IDLE_TIMEOUT_MILLIS) {
+            // Don't integrate over a gap of >5s; the totals carry on
+            last_power_timestamp = ts;
         }
         // Update stored values
         const unsigned long elapsed_ms = ts - last_power_timestamp;
         last_power_timestamp = ts;
         current_power_deciwatt = new_power_deciwatts;
-        current_mph = mph_from_power(current_power_deciwatt);
+        // Table generated from the piecewise polynomial regression in
+        // decoding_speed/regress_speed.py
+        current_cmph = speed_from_deciwatts(current_power_deciwatt);
 
         // Integrate energy
         /* deciwatts/10 * seconds = joules
@@ -102,8 +110,11 @@ class RideStatus {
          * deciwatts/10 * ms/1000 / 1000 = kilojoules
          * deciwatts * ms / 1e7 = kj
          */
-        const float kj_per_deciwattms = 1e-7f;
-        total_energy_kj += (current_power_deciwatt * elapsed_ms) * kj_per_deciwattms;
+        partial_energy_deciwattms += (uint32_t) current_power_deciwatt * elapsed_ms;
+        while (partial_energy_deciwattms >= DECIWATTMS_PER_KJ) {
+            partial_energy_deciwattms -= DECIWATTMS_PER_KJ;
+            total_energy_kj++;
+        }
 
         // Integrate wheel revs
         /* Constant computed for 700c x 25 wheel at 2105mm
@@ -112,19 +123,12 @@ class RideStatus {
          *  1603944 mm / 2105mm = 764.53397 wheel revs per mi
          *  1 / 3.6e6 hr / msec
          *  1 mi/hr * 764.53397 rev/mi => 764.53397 rev/hr * 1/3.6e6 hr/msec
-         *  => 2.1237e-4 rev/ms/mph
+         *  => 2.1237e-4 rev/ms/mph = 2.1237 urev/ms per 0.01mph
+         *  2.1237 * 16384 = 34796
          */
-        const float wheelrev_per_ms_mph = 2.1237e-4;
-        const float rev_per_ms = wheelrev_per_ms_mph * current_mph;
-        const float increm_wheel_revs = rev_per_ms * elapsed_ms;
-        update_revs_and_time(total_wheel_revolutions, last_wheel_rev_timestamp,
-                             increm_wheel_revs, rev_per_ms, ts);
-        if (total_wheel_revolutions > 16777215.0f) {
-             // Prevent FP32 loss of precision
-             // Technically this is non-compliant - we should never roll over
-             // But I don't want to deal with keeping the rest of the 32b elsewhere.
-             total_wheel_revolutions -= (unsigned long) total_wheel_revolutions;
-        }
+        const uint32_t urev_per_ms = ((uint32_t) current_cmph * 34796) >> 14;
+        // 32 bits of wheel revs never roll over in practice, as CSC requires
+        wheel.advance(urev_per_ms, elapsed_ms, ts);
     }
     void update_new_resistance(const uint16_t new_raw_resistance,
                                const ResistanceLUT& lut) {
@@ -133,11 +137,26 @@ class RideStatus {
     }
     public:
     RideStatus(Logger& logger_): logger(logger_) {};
-    void initialize() {
-        current_rpm = current_power_deciwatt = current_raw_resistance = current_resistance = 0;
-        total_crank_revolutions = total_wheel_revolutions = total_energy_kj = current_mph = 0;
+    void initialize(const RideTotals* saved = NULL) {
+        current_rpm = current_power_deciwatt = current_raw_resistance = 0;
+        // Unknown until the first resistance reply is translated
+        current_resistance = 0xFF;
+        current_cmph = 0;
+        total_energy_kj = partial_energy_deciwattms = 0;
         last_rpm_timestamp = last_power_timestamp = 0;
-        last_crank_rev_timestamp = last_wheel_rev_timestamp = 0;
+        crank.reset(0);
+        wheel.reset(0);
+        // Pick up where the last boot left off
+        if (saved) {
+            total_energy_kj = saved->energy_kj;
+            crank.revs = saved->crank_revs;
+            wheel.revs = saved->wheel_revs;
+        }
+        workout_start_kj = total_energy_kj;
+    }
+    RideTotals totals() const {
+        RideTotals totals = {total_energy_kj, crank.revs, wheel.revs};
+        return totals;
     }
     uint16_t current_watts() const {
         uint16_t watts = current_power_deciwatt / 10;
@@ -147,46 +166,74 @@ class RideStatus {
     uint16_t current_deciwatts() const {
         return current_power_deciwatt;
     }
+    uint16_t cadence_rpm() const {
+        return current_rpm;
+    }
+    uint16_t speed_cmph() const {
+        return current_cmph;
+    }
+    uint8_t resistance_percent() const {
+        // 0xFF until the LUT can translate it
+        return current_resistance;
+    }
     uint16_t total_kj() const {
+        // Rolls over, as CP accumulated energy may
         return (uint16_t) total_energy_kj;
     }
+    uint16_t workout_kj() const {
+        // Since the workout began, for FTMS total energy; saturates short
+        // of 0xFFFF, which means not available there
+        const uint32_t kj = total_energy_kj - workout_start_kj;
+        return kj < 0xFFFE ? kj : 0xFFFE;
+    }
     uint32_t integral_wheel_revolutions() const {
-        return (uint32_t) total_wheel_revolutions;
+        return wheel.revs;
     }
     uint16_t integral_crank_revolutions() const {
-        return (uint16_t) total_crank_revolutions;
+        return (uint16_t) crank.revs;
     }
     uint32_t last_crank_rev_ts_millis() const {
-        return last_crank_rev_timestamp;
+        return crank.event_ts;
     }
     uint32_t last_wheel_rev_ts_millis() const {
-        return last_wheel_rev_timestamp;
+        return wheel.event_ts;
+    }
+    unsigned long last_sample_millis() const {
+        // When the newest power or cadence reading was taken
+        return last_power_timestamp > last_rpm_timestamp ?
+               last_power_timestamp : last_rpm_timestamp;
+    }
+    bool is_active(const unsigned long now) const {
+        // Pedaling or producing power, and the bike is still reporting it
+        return (current_rpm > 0 || current_power_deciwatt > 0) &&
+               (now - last_sample_millis() < RIDE_IDLE_TIMEOUT_MILLIS);
     }
     void update(const BikeMessage& msg, const ResistanceLUT& lut) {
         char logbuf[32];
-        if (!msg.is_valid) return false;
-        if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
+        if (!msg.is_valid) return;
+        if (LOG_ENABLED(LOG_LEVEL_DEBUG)) {
             snprintf_P(logbuf, 32, PSTR("req: %hhu\n"), msg.request);
             logger.print(logbuf);
         }
         const unsigned long update_start = micros();
         if (msg.request == RPM) {
-            if (LOG_LEVEL >= LOG_LEVEL_DEBUG) logger.print(F("Updating RPM\n"));
+            LOG_PRINT(LOG_LEVEL_DEBUG, F("Updating RPM\n"));
             update_new_rpm(msg.value);
        } else if (msg.request == POWER) {
-            if (LOG_LEVEL >= LOG_LEVEL_DEBUG) logger.print(F("Updating power\n"));
+            LOG_PRINT(LOG_LEVEL_DEBUG, F("Updating power\n"));
             update_new_power(msg.value);
         } else if (msg.request == RESISTANCE) {
-            if (LOG_LEVEL >= LOG_LEVEL_DEBUG) logger.print(F("Updating resistance\n"));
+            LOG_PRINT(LOG_LEVEL_DEBUG, F("Updating resistance\n"));
             update_new_resistance(msg.value, lut);
         } else {
             logger.print(F("DEFAULT CASE IN RIDESTATUS::UPDATE\n"));
             snprintf_P(logbuf, 32, "request %hhX\n",msg.request);
             logger.print(logbuf);
+            logger.flush();
             while(1);
         }
         const unsigned long update_end = micros();
-        if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
+        if (LOG_ENABLED(LOG_LEVEL_DEBUG)) {
             if (msg.request == RPM) {
                 snprintf_P(logbuf, 32, PSTR("RPM upd %luus\n"), update_end-update_start);
             } else if (msg.request == POWER) {
@@ -197,46 +244,51 @@ class RideStatus {
             logger.print(logbuf);
         }
     }
+    void append_power(Formatter& f) const {
+        f.fixed(current_power_deciwatt, 1, 6).chr('W');
+    }
+    void append_speed(Formatter& f) const {
+        // Hundredths of a mph, shown to a tenth
+        f.fixed(current_cmph / 10, 1, 4);
+    }
+    void append_energy(Formatter& f) const {
+        f.dec(total_energy_kj, 4).chr('.')
+         .dec((uint16_t) (partial_energy_deciwattms / 10000), 3, '0');
+    }
     void serial_status_text() const {
-        const int buflen = 128;
-        char logbuf[128];
-        char mph_str[5], crank_str[8], wheel_str[8], kj_str[9], power_str[8];
-        snprintf_P(power_str, 8, PSTR("% 4u.%uW"),
-                   current_power_deciwatt/10,
-                   current_power_deciwatt % 10);
-        dtostrf(current_mph, 4, 1, mph_str);
-        dtostrf(total_energy_kj, 8, 3, kj_str);
+        ScratchBuffer logbuf(128);
+        Formatter f(logbuf.data, logbuf.len);
+        // Not LOG_ENABLED: the dump commands want the full status even
+        // in builds without DEBUG logging.
         if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
-            snprintf_P(logbuf, buflen,
-                               PSTR("\tRideStatus\n"
-                                    "\t\trpm: %u @ lrt %lu\n"
-                                    "\t\tpower: %s @ lpt %lu\n"
-                               ),
-                               current_rpm, last_rpm_timestamp,
-                               power_str,
-                               last_power_timestamp);
-            logger.print(logbuf);
-            dtostrf(total_crank_revolutions, 6, 2, crank_str);
-            dtostrf(total_wheel_revolutions, 6, 2, wheel_str);
-            snprintf_P(logbuf, buflen,
-                       PSTR("\t\tspeed: %s mph\n"
-                            "\t\tresistance: %hhu(%u)\n"),
-                       mph_str,
-                       current_resistance, current_raw_resistance);
-            logger.print(logbuf);
-            snprintf_P(logbuf, buflen,
-                       PSTR("\t\tcranks: %s @ %lu\n"
-                            "\t\twheels: %s @ %lu\n"
-                            "\t\tenergy: %skJ\n"),
-                        crank_str, last_crank_rev_timestamp,
-                        wheel_str, last_wheel_rev_timestamp,
-                        kj_str);
-            logger.print(logbuf);
+            f.str_P(PSTR("\tRideStatus\n\t\trpm: ")).dec(current_rpm)
+             .str_P(PSTR(" @ lrt ")).dec(last_rpm_timestamp)
+             .str_P(PSTR("\n\t\tpower: "));
+            append_power(f);
+            f.str_P(PSTR(" @ lpt ")).dec(last_power_timestamp).chr('\n');
+            logger.print(f.c_str());
+            f.reset().str_P(PSTR("\t\tspeed: "));
+            append_speed(f);
+            f.str_P(PSTR(" mph\n\t\tresistance: ")).dec(current_resistance)
+             .chr('(').dec(current_raw_resistance).str_P(PSTR(")\n"));
+            logger.print(f.c_str());
+            f.reset().str_P(PSTR("\t\tcranks: ")).dec(crank.revs).chr('.').dec(crank.hundredths(), 2, '0')
+             .str_P(PSTR(" @ ")).dec(crank.event_ts)
+             .str_P(PSTR("\n\t\twheels: ")).dec(wheel.revs).chr('.').dec(wheel.hundredths(), 2, '0')
+             .str_P(PSTR(" @ ")).dec(wheel.event_ts)
+             .str_P(PSTR("\n\t\tenergy: "));
+            append_energy(f);
+            f.str_P(PSTR("kJ\n"));
+            logger.print(f.c_str());
         } else if (LOG_LEVEL >= LOG_LEVEL_INFO) {
-            snprintf_P(logbuf, buflen,
-                       PSTR("% 3urpm %smph %s %skJ\n"),
-                       current_rpm, mph_str, power_str, kj_str);
-            logger.print(logbuf);
+            f.dec(current_rpm, 3).str_P(PSTR("rpm "));
+            append_speed(f);
+            f.str_P(PSTR("mph "));
+            append_power(f);
+            f.chr(' ');
+            append_energy(f);
+            f.str_P(PSTR("kJ\n"));
+            logger.print(f.c_str());
         }
     }
 };
@@ -1,5 +1,5 @@
-/* Human-readable constants for the Bluetooth LE Cycling Power Profile
- * and Cycling Speed and Cadence Profile.
+/* Human-readable constants for the Bluetooth LE Cycling Power Profile,
+ * Cycling Speed and Cadence Profile and Fitness Machine Service.
  *
  * Part of the PeloMon project. See the accompanying blog post at
  * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
@@ -97,4 +97,32 @@
 #define CPM_ACCUMULATED_ENERGY_PRESENT ((uint16_t) 1 << 11)
 #define CPM_OFFSET_COMPENSATION_ACTION_REQUIRED ((uint16_t) 1 << 12)
 
+/* Fitness Machine Service, Indoor Bike Data only: the bike is not
+ * controllable, so there is no control point or target settings.
+ */
+#define FITNESS_MACHINE_SERVICE_UUID ((uint16_t) 0x1826)
+
+#define FITNESS_MACHINE_FEATURE_CHAR_UUID ((uint16_t) 0x2ACC)
+#define FMF_AVERAGE_SPEED_SUPPORTED ((uint32_t) 1 << 0)
+#define FMF_CADENCE_SUPPORTED ((uint32_t) 1 << 1)
+#define FMF_TOTAL_DISTANCE_SUPPORTED ((uint32_t) 1 << 2)
+#define FMF_RESISTANCE_LEVEL_SUPPORTED ((uint32_t) 1 << 7)
+#define FMF_EXPENDED_ENERGY_SUPPORTED ((uint32_t) 1 << 9)
+#define FMF_POWER_MEASUREMENT_SUPPORTED ((uint32_t) 1 << 14)
+
+#define INDOOR_BIKE_DATA_CHAR_UUID ((uint16_t) 0x2AD2)
+// Clear: instantaneous speed is present
+#define IBD_MORE_DATA ((uint16_t) 1 << 0)
+#define IBD_AVERAGE_SPEED_PRESENT ((uint16_t) 1 << 1)
+#define IBD_INSTANTANEOUS_CADENCE_PRESENT ((uint16_t) 1 << 2)
+#define IBD_AVERAGE_CADENCE_PRESENT ((uint16_t) 1 << 3)
+#define IBD_TOTAL_DISTANCE_PRESENT ((uint16_t) 1 << 4)
+#define IBD_RESISTANCE_LEVEL_PRESENT ((uint16_t) 1 << 5)
+#define IBD_INSTANTANEOUS_POWER_PRESENT ((uint16_t) 1 << 6)
+#define IBD_AVERAGE_POWER_PRESENT ((uint16_t) 1 << 7)
+#define IBD_EXPENDED_ENERGY_PRESENT ((uint16_t) 1 << 8)
+#define IBD_HEART_RATE_PRESENT ((uint16_t) 1 << 9)
+#define IBD_ENERGY_NOT_AVAILABLE_16 ((uint16_t) 0xFFFF)
+#define IBD_ENERGY_NOT_AVAILABLE_8 ((uint8_t) 0xFF)
+
 #endif
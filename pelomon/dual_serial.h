@@ -0,0 +1,247 @@
+/* Interrupt-driven receiver for the two Peloton serial lines.
+ *
+ * SoftwareSerial can only listen() to one port at a time, so bytes
+ * arriving on the other line are lost. This receiver instead watches
+ * both RX pins with pin-change interrupts and decodes each line from
+ * the timing of its edges against free-running Timer1, so the HU and
+ * bike streams are captured concurrently and buffered until the main
+ * loop gets around to draining them.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _DUAL_SERIAL_H_
+#define _DUAL_SERIAL_H_
+#include <avr/interrupt.h>
+#include "spsc_ring.h"
+
+#define PELOTON_BAUD 19200
+// Must be a power of two, at most 128. Enough to hold a few complete frames per line.
+#define DUAL_SERIAL_RING_LEN 32
+
+/* Timer1 runs at F_CPU/8: 1us ticks on the 8MHz Feather.
+ * A 19200bps bit is ~52 ticks. Edges are placed relative to the start
+ * bit of their frame, so rounding error does not accumulate and the
+ * accumulated clock error over a 10-bit frame is under one tick.
+ */
+#define DUAL_SERIAL_BIT_TICKS ((F_CPU / 8 + PELOTON_BAUD / 2) / PELOTON_BAUD)
+// No frame can last longer than ten bit times after its last edge
+#define DUAL_SERIAL_FRAME_TIMEOUT_TICKS (10 * DUAL_SERIAL_BIT_TICKS + \
+                                         DUAL_SERIAL_BIT_TICKS / 2)
+#define DUAL_SERIAL_IDLE 0xFF
+
+/* Receive timestamps are micros() in 64us ticks, kept to 16 bits: fine
+ * enough to time a 520us byte, and wrap-safe to compare across 2s.
+ */
+#define RX_TICK_SHIFT 6
+#define RX_TICKS_FROM_MICROS(us) ((us) >> RX_TICK_SHIFT)
+
+inline uint16_t rx_ticks() {
+    return (uint16_t) RX_TICKS_FROM_MICROS(micros());
+}
+inline uint16_t rx_ticks_from_millis(const unsigned long ms) {
+    // micros() and millis() * 1000 wrap together
+    return (uint16_t) RX_TICKS_FROM_MICROS(ms * 1000UL);
+}
+inline unsigned long rx_ticks_to_micros(const uint16_t ticks) {
+    // micros() at a recent tick timestamp, to within a tick
+    return micros() - ((unsigned long) (uint16_t) (rx_ticks() - ticks) << RX_TICK_SHIFT);
+}
+inline uint16_t rx_ticks_to_millis(const uint16_t ticks) {
+    // Low 16 bits of millis() at a recent tick timestamp
+    const unsigned long ago = (unsigned long) (uint16_t) (rx_ticks() - ticks) << RX_TICK_SHIFT;
+    return (uint16_t) (millis() - ago / 1000);
+}
+
+struct TimestampedByte {
+    uint8_t value;
+    uint16_t timestamp;     // rx_ticks() at the stop bit
+};
+
+class SerialRxChannel {
+    public:
+    // Pushed by the ISR, popped by the main loop
+    SpscRing<TimestampedByte, DUAL_SERIAL_RING_LEN> ring;
+    volatile uint16_t overflows;    // read with overflow_count()
+
+    // Edge decoder state, owned by the ISRs
+    uint8_t slot;           // bit slot of the last edge (0=start), or IDLE
+    uint8_t data;
+    uint8_t level;          // logical line level after the last edge
+    uint16_t frame_start;   // Timer1 count at the start bit edge
+
+    // Pin registers, resolved once in begin()
+    volatile uint8_t* pin_register;
+    uint8_t pin_mask;
+
+    // Timestamp of the byte most recently returned by read()
+    uint16_t last_timestamp;
+
+    void begin(const uint8_t pin) {
+        pin_register = portInputRegister(digitalPinToPort(pin));
+        pin_mask = digitalPinToBitMask(pin);
+        ring.reset();
+        overflows = 0;
+        slot = DUAL_SERIAL_IDLE;
+        data = 0;
+        level = 1;
+        last_timestamp = 0;
+    }
+    // Present the same interface as SoftwareSerial so PelotonProxy
+    // can treat this like any other port.
+    void listen() {
+        // Both lines are always captured.
+        return;
+    }
+    int8_t available() const {
+        return ring.count();
+    }
+    uint8_t read() {
+        TimestampedByte entry;
+        if (!ring.pop(entry)) return 0xFF;
+        last_timestamp = entry.timestamp;
+        return entry.value;
+    }
+    uint16_t timestamp() const {
+        return last_timestamp;
+    }
+    uint16_t overflow_count() const {
+        // Two bytes, so keep the ISR from updating it halfway through
+        uint8_t oldSREG = SREG;
+        cli();
+        const uint16_t count = overflows;
+        SREG = oldSREG;
+        return count;
+    }
+
+    // Everything below runs in interrupt context.
+    inline bool read_level() const {
+        return ((*pin_register & pin_mask) != 0) != INVERT_PELOTON_SERIAL;
+    }
+    inline void push(const uint8_t value) {
+        TimestampedByte entry;
+        entry.value = value;
+        entry.timestamp = rx_ticks();
+        if (!ring.push(entry)) overflows++;
+    }
+    inline void mark_ones(uint8_t from_slot, uint8_t to_slot) {
+        // Data bits occupy slots 1 through 8, LSB first
+        if (from_slot < 1) from_slot = 1;
+        if (to_slot > 9) to_slot = 9;
+        for (uint8_t s = from_slot; s < to_slot; s++)
+            data |= (1 << (s - 1));
+    }
+    // Returns true if the caller should (re)arm the frame timeout.
+    inline bool on_edge(const uint8_t new_level, const uint16_t now) {
+        if (slot == DUAL_SERIAL_IDLE) {
+            if (new_level) return false;
+            // Falling edge out of idle is a start bit
+            slot = 0;
+            data = 0;
+            level = 0;
+            frame_start = now;
+            return true;
+        }
+        // Find the bit slot this edge falls on; the previous level was
+        // held from the last edge's slot up to here.
+        uint16_t elapsed = (now - frame_start) + DUAL_SERIAL_BIT_TICKS / 2;
+        uint8_t end_slot = 0;
+        while (elapsed >= DUAL_SERIAL_BIT_TICKS && end_slot < 10) {
+            elapsed -= DUAL_SERIAL_BIT_TICKS;
+            end_slot++;
+        }
+        if (end_slot < slot) end_slot = slot;
+        if (level) mark_ones(slot, end_slot);
+        level = new_level;
+        if (end_slot < 9) {
+            slot = end_slot;
+            return true;
+        }
+        if (new_level) {
+            // Rising edge: a low run either ended in the stop bit
+            // (framing error, drop it) or right before it.
+            if (end_slot == 9) push(data);
+            slot = DUAL_SERIAL_IDLE;
+            return false;
+        }
+        // Falling edge after the data bits: stop bit and maybe some
+        // idle passed, and this edge is the next start bit.
+        push(data);
+        slot = 0;
+        data = 0;
+        frame_start = now;
+        return true;
+    }
+    inline void on_timeout() {
+        // Line has been quiet for longer than a frame: any trailing
+        // bits are at the current level.
+        if (slot == DUAL_SERIAL_IDLE) return;
+        if (level) {
+            mark_ones(slot, 9);
+            push(data);
+        }
+        slot = DUAL_SERIAL_IDLE;
+    }
+};
+
+class DualSerialReceiver {
+    public:
+    SerialRxChannel hu;
+    SerialRxChannel bike;
+
+    void begin() {
+        uint8_t oldSREG = SREG;
+        cli();
+        hu.begin(PIN_RX_FROM_HU);
+        bike.begin(PIN_RX_FROM_BIKE);
+        pinMode(PIN_RX_FROM_HU, INPUT);
+        pinMode(PIN_RX_FROM_BIKE, INPUT);
+        hu.level = hu.read_level();
+        bike.level = bike.read_level();
+
+        // Timer1 free-running at F_CPU/8; compare A times out bike
+        // frames and compare B times out HU frames.
+        TCCR1A = 0;
+        TCCR1B = _BV(CS11);
+        TIMSK1 |= _BV(OCIE1A) | _BV(OCIE1B);
+
+        // Both RX pins are on the 32u4's single pin-change port
+        *digitalPinToPCMSK(PIN_RX_FROM_HU) |= _BV(digitalPinToPCMSKbit(PIN_RX_FROM_HU));
+        *digitalPinToPCMSK(PIN_RX_FROM_BIKE) |= _BV(digitalPinToPCMSKbit(PIN_RX_FROM_BIKE));
+        *digitalPinToPCICR(PIN_RX_FROM_HU) |= _BV(digitalPinToPCICRbit(PIN_RX_FROM_HU));
+        SREG = oldSREG;
+    }
+    inline void poll() {
+        // Bytes are pushed by the ISRs
+        return;
+    }
+};
+
+DualSerialReceiver peloton_rx;
+
+ISR(PCINT0_vect) {
+    const uint16_t now = TCNT1;
+    const uint8_t hu_level = peloton_rx.hu.read_level();
+    const uint8_t bike_level = peloton_rx.bike.read_level();
+    if (hu_level != peloton_rx.hu.level) {
+        if (peloton_rx.hu.on_edge(hu_level, now))
+            OCR1B = now + DUAL_SERIAL_FRAME_TIMEOUT_TICKS;
+    }
+    if (bike_level != peloton_rx.bike.level) {
+        if (peloton_rx.bike.on_edge(bike_level, now))
+            OCR1A = now + DUAL_SERIAL_FRAME_TIMEOUT_TICKS;
+    }
+}
+
+ISR(TIMER1_COMPA_vect) {
+    peloton_rx.bike.on_timeout();
+}
+
+ISR(TIMER1_COMPB_vect) {
+    peloton_rx.hu.on_timeout();
+}
+#endif
@@ -28,6 +28,14 @@
  *  71: BLE: Cycling Speed/Cadence Measurement GATT ID
  *  72: BLE: Cycling Speed/Cadence Sensor Location GATT ID
  *  73: BLE: Cycling Speed/Cadence Control Point GATT ID
+ *  74: BLE: GATT table hash, low byte
+ *  75: BLE: GATT table hash, high byte
+ *  76: BLE: services to advertise (BLE_SERVICES_*)
+ *  77: BLE: Fitness Machine Service ID
+ *  78: BLE: Fitness Machine Feature GATT ID
+ *  79: BLE: Indoor Bike Data GATT ID
+ *  80-127: unused
+ *  128-1023: ride totals log, 16 byte records (see ride_log.h)
  */
 enum _eeprom_map {
         EEPROM_RESISTANCE_LUT_BASE_ADDRESS = 0,
@@ -42,6 +50,14 @@ enum _eeprom_map {
         EEPROM_BLE_CSC_MEASUREMENT_ID_ADDRESS,
         EEPROM_BLE_CSC_SENSOR_LOCATION_ID_ADDRESS,
         EEPROM_BLE_SC_CONTROL_POINT_ID_ADDRESS,
-        EEPROM_MAX_ADDRESS
+        EEPROM_BLE_GATT_HASH_ADDRESS,
+        EEPROM_BLE_SERVICES_ADDRESS = EEPROM_BLE_GATT_HASH_ADDRESS + 2,
+        EEPROM_BLE_FTMS_SERVICE_ID_ADDRESS,
+        EEPROM_BLE_FTMS_FEATURE_ID_ADDRESS,
+        EEPROM_BLE_FTMS_INDOOR_BIKE_DATA_ID_ADDRESS,
+        EEPROM_MAX_ADDRESS,
+        // Not cleared by freset, which only wipes the settings above
+        EEPROM_RIDE_LOG_BASE_ADDRESS = 128,
+        EEPROM_RIDE_LOG_END_ADDRESS = 1024
 };
 #endif
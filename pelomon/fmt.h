@@ -0,0 +1,103 @@
+/* Minimal text formatting for status and trace output.
+ *
+ * snprintf_P goes through the full vfprintf, which parses the format
+ * string and divides 32 bits at a time for every digit. The periodic
+ * status lines only ever need unsigned decimals, hex bytes and fixed-point
+ * values, so Formatter appends those straight into a caller's buffer.
+ * Values that fit in 16 bits are split into digits with a multiply in
+ * place of the division. Output past the end of the buffer is dropped;
+ * the buffer is always terminated.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _FMT_H_
+#define _FMT_H_
+#include <avr/pgmspace.h>
+
+const uint16_t FMT_POW10[] PROGMEM = {1, 10, 100, 1000, 10000};
+
+class Formatter {
+    public:
+    Formatter(char* buf, const uint16_t cap): buf_(buf), cap_(cap), len_(0) {
+        buf_[0] = '\0';
+    }
+    const char* c_str() const {
+        return buf_;
+    }
+    uint16_t length() const {
+        return len_;
+    }
+    Formatter& reset() {
+        len_ = 0;
+        buf_[0] = '\0';
+        return *this;
+    }
+    Formatter& chr(const char c) {
+        if (len_ + 1 < cap_) {
+            buf_[len_++] = c;
+            buf_[len_] = '\0';
+        }
+        return *this;
+    }
+    Formatter& str(const char* s) {
+        while (*s) chr(*s++);
+        return *this;
+    }
+    Formatter& str_P(const char* s) {
+        for (char c = pgm_read_byte(s); c; c = pgm_read_byte(++s)) chr(c);
+        return *this;
+    }
+    Formatter& dec(uint32_t value, const uint8_t width = 0, const char pad = ' ') {
+        // Unsigned decimal, right-aligned in at least width characters
+        char digits[10];
+        uint8_t n = 0;
+        while (value > 0xFFFF) {
+            digits[n++] = '0' + value % 10;
+            value /= 10;
+        }
+        uint16_t rest = value;
+        do {
+            // Exact division by 10 for any 16 bit value
+            const uint16_t quotient = ((uint32_t) rest * 0xCCCD) >> 19;
+            digits[n++] = '0' + (rest - quotient * 10);
+            rest = quotient;
+        } while (rest);
+        for (uint8_t i = n; i < width; i++) chr(pad);
+        while (n) chr(digits[--n]);
+        return *this;
+    }
+    Formatter& fixed(const uint32_t scaled, const uint8_t decimals, const uint8_t width = 0) {
+        // scaled / 10^decimals with exactly that many decimals (at most 4),
+        // right-aligned in at least width characters
+        const uint16_t divisor = pgm_read_word(&FMT_POW10[decimals]);
+        const uint8_t whole_width = width > decimals + 1 ? width - decimals - 1 : 0;
+        if (scaled <= 0xFFFF) {
+            // 16 bit division is several times cheaper
+            dec((uint16_t) scaled / divisor, whole_width);
+            if (decimals) chr('.').dec((uint16_t) scaled % divisor, decimals, '0');
+        } else {
+            dec(scaled / divisor, whole_width);
+            if (decimals) chr('.').dec(scaled % divisor, decimals, '0');
+        }
+        return *this;
+    }
+    Formatter& hex8(const uint8_t value) {
+        return chr(hex_digit(value >> 4)).chr(hex_digit(value & 0x0F));
+    }
+
+    private:
+    char* const buf_;
+    const uint16_t cap_;
+    uint16_t len_;
+
+    static char hex_digit(const uint8_t nibble) {
+        return nibble < 10 ? '0' + nibble : 'A' + nibble - 10;
+    }
+};
+
+#endif
@@ -0,0 +1,118 @@
+/* Measured bike reply latency and the timeouts derived from it.
+ *
+ * Two histograms of receive ticks: from the end of the HU request to the
+ * bike's first reply byte, and between consecutive bytes of the reply.
+ * Each timeout is a high percentile of what has been seen plus a margin,
+ * so a reply that is not coming is given up on as soon as it is clearly
+ * late rather than after a fixed worst case. Bucket counts are halved
+ * whenever one fills, so the model follows slow drift.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+
+// 32 buckets of 4 ticks (256us) span 8ms; the last holds everything later
+#define LATENCY_NUM_BUCKETS 32
+#define LATENCY_BUCKET_TICKS 4
+// Keep the fixed timeout until this many replies have been measured
+#define LATENCY_MIN_SAMPLES 64
+
+#define LATENCY_MAX_TICKS RX_TICKS_FROM_MICROS(BIKE_RESPONSE_TIMEOUT_MILLIS * 1000UL)
+#define LATENCY_MIN_TICKS RX_TICKS_FROM_MICROS(BIKE_TIMEOUT_MIN_MICROS)
+#define LATENCY_MARGIN_TICKS RX_TICKS_FROM_MICROS(BIKE_TIMEOUT_MARGIN_MICROS)
+
+class LatencyHistogram {
+    public:
+    uint8_t buckets[LATENCY_NUM_BUCKETS];
+    uint32_t samples;           // since reset, not decayed
+    uint16_t max_ticks;
+    uint16_t timeout_ticks;
+
+    void reset() {
+        memset(buckets, 0, sizeof(buckets));
+        samples = 0;
+        max_ticks = 0;
+        timeout_ticks = LATENCY_MAX_TICKS;
+    }
+    void record(const uint16_t ticks) {
+        uint8_t bucket = ticks / LATENCY_BUCKET_TICKS;
+        if (bucket >= LATENCY_NUM_BUCKETS) bucket = LATENCY_NUM_BUCKETS - 1;
+        if (buckets[bucket] == 0xFF) {
+            for (uint8_t i = 0; i < LATENCY_NUM_BUCKETS; buckets[i++] >>= 1);
+        }
+        buckets[bucket]++;
+        if (ticks > max_ticks) max_ticks = ticks;
+        // Cheap enough to redo every so often rather than per byte
+        if ((++samples & (LATENCY_MIN_SAMPLES - 1)) == 0) update_timeout();
+    }
+    uint16_t percentile_ticks(const uint8_t percent) const {
+        // Upper edge of the bucket holding the given percentile
+        uint16_t total = 0;
+        for (uint8_t i = 0; i < LATENCY_NUM_BUCKETS; total += buckets[i++]);
+        const uint16_t target = ((uint32_t) total * percent + 99) / 100;
+        uint16_t seen = 0;
+        uint8_t bucket = 0;
+        for (; bucket < LATENCY_NUM_BUCKETS - 1; bucket++) {
+            seen += buckets[bucket];
+            if (seen >= target) break;
+        }
+        if (bucket == LATENCY_NUM_BUCKETS - 1) return LATENCY_MAX_TICKS;
+        return (bucket + 1) * LATENCY_BUCKET_TICKS;
+    }
+    void update_timeout() {
+        if (samples < LATENCY_MIN_SAMPLES) return;
+        uint16_t timeout = percentile_ticks(BIKE_TIMEOUT_PERCENTILE) + LATENCY_MARGIN_TICKS;
+        if (timeout < LATENCY_MIN_TICKS) timeout = LATENCY_MIN_TICKS;
+        if (timeout > LATENCY_MAX_TICKS) timeout = LATENCY_MAX_TICKS;
+        timeout_ticks = timeout;
+    }
+};
+
+class BikeLatencyModel {
+    public:
+    LatencyHistogram first_byte;
+    LatencyHistogram gap;
+
+    void reset() {
+        first_byte.reset();
+        gap.reset();
+    }
+    LatencyHistogram& histogram(const bool reply_started) {
+        return reply_started ? gap : first_byte;
+    }
+    uint16_t timeout_ticks(const bool reply_started) const {
+        return reply_started ? gap.timeout_ticks : first_byte.timeout_ticks;
+    }
+    void dump(Logger& logger, const uint32_t timed_out) const {
+        char buf[64];
+        snprintf_P(buf, 64, PSTR("Bike latency (us), %lu timed out\n"), timed_out);
+        logger.print(buf);
+        logger.print(F("         samples  p50  p99  max timeout\n"));
+        dump_histogram(logger, PSTR("first"), first_byte);
+        dump_histogram(logger, PSTR("gap"), gap);
+    }
+    void dump_histogram(Logger& logger, const char* name,
+                        const LatencyHistogram& hist) const {
+        char buf[64];
+        char label[8];
+        strncpy_P(label, name, 8);
+        label[7] = '\0';
+        snprintf_P(buf, 64, PSTR("%-7s %8lu %4u %4u %4lu %5u\n"), label,
+                   hist.samples,
+                   hist.percentile_ticks(50) << RX_TICK_SHIFT,
+                   hist.percentile_ticks(99) << RX_TICK_SHIFT,
+                   (uint32_t) hist.max_ticks << RX_TICK_SHIFT,
+                   hist.timeout_ticks << RX_TICK_SHIFT);
+        logger.print(buf);
+    }
+};
+
+BikeLatencyModel bike_latency;
+
+#endif
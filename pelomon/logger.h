@@ -10,61 +10,160 @@
 #ifndef _LOGGER_H_
 #define _LOGGER_H_
 #include <avr/pgmspace.h>
+#include "spsc_ring.h"
 
 #ifndef MIN
 #define MIN(x,y) (x) < (y) ? (x) : (y)
 #endif
 
+/* Guard log sites with LOG_ENABLED(level) rather than testing LOG_LEVEL
+ * directly. Levels above LOG_LEVEL_COMPILED fold to a constant false, so
+ * the whole site and its format strings are dropped from the build;
+ * levels at or below it are still switched at runtime through LOG_LEVEL.
+ */
+#define LOG_ENABLED(level) ((level) <= LOG_LEVEL_COMPILED && LOG_LEVEL >= (level))
+#define LOG_PRINT(level, msg) do { \
+        if (LOG_ENABLED(level)) logger.print(msg); \
+    } while (0)
+
+
+// Must be a power of two, at most 128
+#ifndef LOG_TX_RING_LEN
+#define LOG_TX_RING_LEN 128
+#endif
+// Largest piece handed to a sink at once; one SDEP packet for BLE
+#define LOG_TX_CHUNK 16
 
+/* Once buffering is enabled, output is queued in a ring and only goes out
+ * to USB serial and the BLE UART when drain() is called from loop(), so
+ * logging never stalls message handling. Bytes that do not fit are
+ * dropped and counted.
+ */
 class Logger {
     private:
         Adafruit_BLE* ble_;
-    public:
-        Logger(): ble_(NULL) {}
-        void set_ble(Adafruit_BLE* ble) {
-            ble_ = ble;
+        SpscRing<uint8_t, LOG_TX_RING_LEN> ring;
+        bool buffered;
+        uint16_t dropped;           // total since boot, saturating
+        uint16_t dropped_unreported;
+
+        uint8_t queued() const {
+            return ring.count();
         }
-        size_t write(uint8_t const* buf, const size_t len) {
-            size_t written = 0, towrite = 0, ble_written = 0;
-            // If nonblocking, conditionally truncate writes
-            const bool nonblock = false;
+        size_t write_sinks(uint8_t const* buf, const size_t len) {
+            size_t written = 0, ble_written = 0;
             if (Serial) {
-                towrite = nonblock ? MIN(Serial.availableForWrite(), len) : len;
-                written = Serial.write(buf, towrite);
+                written = Serial.write(buf, len);
             }
             if (ble_ != NULL) {
                 ble_written = ble_->writeBLEUart(buf, len);
             }
             return ble_written > written ? ble_written : written;
         }
+        void report_drops() {
+            char buf[24];
+            snprintf_P(buf, 24, PSTR("[log dropped %u]\n"), dropped_unreported);
+            dropped_unreported = 0;
+            write((uint8_t const*) buf, strlen(buf));
+        }
+    public:
+        Logger(): ble_(NULL), buffered(false), dropped(0), dropped_unreported(0) {
+            ring.reset();
+        }
+        void set_ble(Adafruit_BLE* ble) {
+            ble_ = ble;
+        }
+        void set_buffered(const bool enable) {
+            // Anything already queued goes out first, in order
+            if (!enable) flush();
+            buffered = enable;
+        }
+        bool is_buffered() const {
+            return buffered;
+        }
+        uint16_t dropped_bytes() const {
+            return dropped;
+        }
+        bool idle() const {
+            // Nothing left for drain() to send
+            return queued() == 0 && dropped_unreported == 0;
+        }
+        size_t write(uint8_t const* buf, const size_t len) {
+            if (!buffered) return write_sinks(buf, len);
+            const uint8_t i = ring.push_n(buf, len < LOG_TX_RING_LEN ? len : LOG_TX_RING_LEN);
+            const uint16_t lost = len - i;
+            if (lost) {
+                dropped = (dropped > 0xFFFF - lost) ? 0xFFFF : dropped + lost;
+                dropped_unreported = (dropped_unreported > 0xFFFF - lost) ?
+                                     0xFFFF : dropped_unreported + lost;
+            }
+            return i;
+        }
+        void drain(const unsigned long budget_micros) {
+            /* Send queued output until the ring is empty or the budget
+             * is spent. Each chunk is bounded, so this overruns the
+             * budget by at most one chunk.
+             */
+            const unsigned long start = micros();
+            while (queued() > 0) {
+                // The BLE UART has to wait for a pending GATT update
+                if (ble_ != NULL && ble_->atcommand_pending()) return;
+                // Only the contiguous run up to the end of the ring
+                uint8_t const* run;
+                uint8_t chunk = ring.contiguous(run);
+                if (chunk > LOG_TX_CHUNK) chunk = LOG_TX_CHUNK;
+                if (Serial && ble_ == NULL) {
+                    // USB alone can be sent without blocking
+                    const int room = Serial.availableForWrite();
+                    if (room <= 0) return;
+                    if (chunk > room) chunk = room;
+                }
+                write_sinks(run, chunk);
+                ring.consume(chunk);
+                if (micros() - start >= budget_micros) return;
+            }
+            if (dropped_unreported) report_drops();
+        }
+        void flush() {
+            if (!buffered) return;
+            // Write out the ring synchronously
+            while (queued() > 0 || dropped_unreported) {
+                uint8_t const* run;
+                const uint8_t chunk = ring.contiguous(run);
+                write_sinks(run, chunk);
+                ring.consume(chunk);
+                if (queued() == 0 && dropped_unreported) report_drops();
+            }
+        }
         size_t print(char c) {
-            return write(&c, 1);
+            return write((uint8_t const*) &c, 1);
         }
         size_t print(char const* str) {
             size_t len = strlen(str);
-            return write(str, len);
+            return write((uint8_t const*) str, len);
         }
         size_t println(char const* str) {
             const char newline = '\n';
-            return print(str) + write(&newline, 1);
+            return print(str) + write((uint8_t const*) &newline, 1);
         }
         size_t print(const __FlashStringHelper* Fstr) {
-            uint8_t buf[63];
+            // Copied out in pieces as big as the scratch arena allows
+            ScratchBuffer buf(63);
             char const* Pstr = (char const*)Fstr;
             size_t len = strlen_P(Pstr);
             size_t written = 0;
             for (size_t base=0; base < len; ) {
                 size_t nbytes = len - base;
-                nbytes = nbytes > 63 ? 63 : nbytes;
-                memcpy_P(buf, Pstr + base, nbytes);
-                written += write(buf, nbytes);
+                nbytes = nbytes > buf.len ? buf.len : nbytes;
+                memcpy_P(buf.data, Pstr + base, nbytes);
+                written += write((uint8_t*) buf.data, nbytes);
                 base += nbytes;
             }
             return written;
         }
         size_t println(const __FlashStringHelper* Fstr) {
             const char newline = '\n';
-            return print(Fstr) + write(&newline, 1);
+            return print(Fstr) + write((uint8_t const*) &newline, 1);
         }
 };
 #endif
@@ -0,0 +1,101 @@
+/* Smoothing of the power and cadence reported over BLE.
+ *
+ * The bike reports each metric about every 300ms, and a single reading
+ * jitters by several watts. Each metric goes through a window of the last
+ * OUTPUT_FILTER_WINDOW readings, weighted by how long each was held: the
+ * same sample-and-hold integration RideStatus uses for energy and crank
+ * revs. The average over the window is therefore exactly the energy (or
+ * revs) over the window divided by its length, so what the watch shows
+ * agrees with the accumulated kJ of the CP measurement. A window of 1
+ * passes readings straight through.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _OUTPUT_FILTER_H_
+#define _OUTPUT_FILTER_H_
+
+#if OUTPUT_FILTER_WINDOW < 1 || OUTPUT_FILTER_WINDOW > 8 || \
+    (OUTPUT_FILTER_WINDOW & (OUTPUT_FILTER_WINDOW - 1))
+#error "OUTPUT_FILTER_WINDOW must be 1, 2, 4 or 8"
+#endif
+
+class HeldAverage {
+    public:
+    void reset() {
+        count = next = 0;
+        weighted_sum = total_ms = 0;
+        average = 0;
+        last_ts = 0;
+    }
+    uint16_t add(const uint16_t value, const unsigned long ts) {
+        // Returns the average including this reading
+        if (count == 0 || ts - last_ts > RIDE_IDLE_TIMEOUT_MILLIS) {
+            // Nothing to weigh a first reading against; start over
+            reset();
+        }
+        // As in RideStatus, a reading stands for the time since the one
+        // before it
+        uint16_t held_ms = count ? ts - last_ts : 1;
+        if (held_ms == 0) held_ms = 1;
+        last_ts = ts;
+        if (count == OUTPUT_FILTER_WINDOW) {
+            weighted_sum -= (uint32_t) values[next] * held[next];
+            total_ms -= held[next];
+        } else {
+            count++;
+        }
+        values[next] = value;
+        held[next] = held_ms;
+        weighted_sum += (uint32_t) value * held_ms;
+        total_ms += held_ms;
+        next = (next + 1) & (OUTPUT_FILTER_WINDOW - 1);
+        average = (weighted_sum + total_ms / 2) / total_ms;
+        return average;
+    }
+    uint16_t value() const {
+        return average;
+    }
+
+    private:
+    uint16_t values[OUTPUT_FILTER_WINDOW];
+    uint16_t held[OUTPUT_FILTER_WINDOW];    // ms, at most the idle timeout
+    uint32_t weighted_sum;
+    uint32_t total_ms;
+    unsigned long last_ts;
+    uint16_t average;
+    uint8_t count;
+    uint8_t next;
+};
+
+class OutputFilter {
+    public:
+    HeldAverage power_deciwatts;
+    HeldAverage cadence_rpm;
+
+    void initialize() {
+        power_deciwatts.reset();
+        cadence_rpm.reset();
+    }
+    void update(const Requests request, const RideStatus& ride) {
+        // After RideStatus has taken the reading
+        const unsigned long ts = ride.last_sample_millis();
+        if (request == POWER) power_deciwatts.add(ride.current_deciwatts(), ts);
+        else if (request == RPM) cadence_rpm.add(ride.cadence_rpm(), ts);
+    }
+    uint16_t watts() const {
+        const uint16_t deciwatts = power_deciwatts.value();
+        return deciwatts / 10 + (deciwatts % 10 >= 5 ? 1 : 0);
+    }
+    uint16_t rpm() const {
+        return cadence_rpm.value();
+    }
+};
+
+OutputFilter output_filter;
+
+#endif
@@ -10,11 +10,13 @@
 #include <Arduino.h>
 #include <avr/wdt.h>
 #include <avr/pgmspace.h>
+#include <avr/sleep.h>
 #include <stdio.h>
 #include <string.h>
 #include <SPI.h>
 
 #include "settings.h"
+#include "sram.h"
 
 // Requires "Adafruit BluefruitLE nRF51" library
 #include "Adafruit_BLE.h"
@@ -23,10 +25,18 @@
 uint8_t LOG_LEVEL;
 
 #include "logger.h"
+#include "fmt.h"
 #include "BLECyclingGatt.h"
 #include "resistance_lut.h"
+#include "profiler.h"
 #include "peloton.h"
+#include "latency.h"
+#include "scheduler.h"
+#include "stats.h"
+#include "speed_table.h"
 #include "RideStatus.h"
+#include "output_filter.h"
+#include "ride_log.h"
 
 #ifndef MIN
 #define MIN(x,y) (x) < (y) ? (x) : (y)
@@ -47,34 +57,60 @@ void serial_log_messagepair_text(void);
  * note - log level global is at top of sketch
  */
 
-#define HU_MSG_BUF_LEN 4
-#define BIKE_MSG_BUF_LEN 15
-
-uint8_t hu_buf[HU_MSG_BUF_LEN];
-uint8_t bike_buf[BIKE_MSG_BUF_LEN];
-uint8_t hu_buf_bytes;
-uint8_t bike_buf_bytes;
-uint8_t running_checksum;
-unsigned long last_status_sent;
+FrameDecoder hu_frame(false);
+FrameDecoder bike_frame(true);
 unsigned long last_time_messages_seen;
-bool boot_sequence_complete;
-
-// Set up an ISR on an arbitrary point in timer0 which ticks
-// over at about 1KHz. Use this to time-limit our wait for
-// bike responses and ensure user responsiveness.
-// This variable is modified in an ISR so needs to be volatile.
-volatile uint8_t bike_wait_ms_remaining;
-SIGNAL(TIMER0_COMPA_vect) {
-    bike_wait_ms_remaining--;
-}
-inline void enable_bike_timeout(void) {
-    // Arbitrary value. Just need interrupt to fire once per timer cycle.
-    OCR0A = 0xB0;
-    TIMSK0 |= _BV(OCIE0A);
-}
-inline void disable_bike_timeout(void) {
-    TIMSK0 &= ~(_BV(OCIE0A));
-}
+// Main loop tasks, in the order of TASKS[] below
+enum TaskId {
+    TASK_RECEIVE,
+    TASK_DECODE,
+    TASK_RIDE,
+    TASK_BLE,
+    TASK_COMMAND,
+    TASK_LOG,
+    TASK_PERSIST,
+    TASK_RIDE_LOG,
+    NUM_TASKS
+};
+// Defined with the task functions further down
+extern const TaskSpec TASKS[NUM_TASKS] PROGMEM;
+// Latest ride metric from the bike, for task_ride()
+BikeMessage ride_metric(bike_frame);
+bool ride_status_log_pending;
+
+// Receive state machine. Both serial lines are buffered by interrupt,
+// so receive_message_pair() never blocks: it drains whatever bytes
+// have arrived and picks up where it left off on the next call.
+enum ReceiveState {
+    WAITING_FOR_HU,
+    WAITING_FOR_BIKE
+};
+uint8_t receive_state;
+// Receive pass for the current Peloton source; see select_receive_source()
+bool (*receive_message_pair)(void);
+// Receive timestamp (rx_ticks()) of the last byte of the pair so far
+uint16_t last_byte_timestamp;
+
+// Frame outcomes on the receive path, reported by the stress command
+struct LinkCounters {
+    uint32_t accepted;      // complete pairs with a valid bike reply
+    uint32_t rejected;      // frames that failed to decode, either line
+    uint32_t timed_out;     // pairs abandoned waiting on the bike
+    unsigned long since;
+};
+LinkCounters link_counters;
+
+// Idle after a quiet spell: radio slowed, MCU asleep between interrupts
+enum PowerState {
+    POWER_ACTIVE,
+    POWER_IDLE
+};
+uint8_t power_state;
+
+// BLE UART command intake: bytes collect here until a newline arrives
+char ble_command_line[32];
+uint8_t ble_command_len;
+unsigned long last_ble_uart_poll;
 
 Logger logger;
 PelotonProxy peloton;
@@ -83,8 +119,6 @@ BLECyclingPower power_service(ble, logger);
 RideStatus ride_status(logger);
 ResistanceLUT resistance_lut(logger);
 
-#define ENABLE_RINGBUF
-#include "ringbuf.h"
 
 void reboot(void) {
     // Reset board using the watchdog timer
@@ -120,32 +154,46 @@ void setup() {
 
     // Initialize serial ports
     Serial.begin(230400); // Communicate with PC, if exists, at 230.4kbps
-    // Give Serial three seconds to connect then charge ahead
-    delay(3000);
+    // On USB power, give a serial monitor a few seconds to connect.
+    // Powered from the bike there is nobody to wait for.
+    if (USBSTA & _BV(VBUS)) {
+        const unsigned long serial_wait_start = millis();
+        while (!Serial && millis() - serial_wait_start < SERIAL_CONNECT_TIMEOUT_MILLIS);
+    }
 
     logger.println(F("Initializing BLE module..."));
-    // Initialize BLE module
+    // Initialize BLE module. The module reboots while the rest of setup
+    // runs; power_service.initialize() waits for it to finish.
     const bool ble_verbose = LOG_LEVEL > LOG_LEVEL_INFO;
-    if ( !ble.begin(ble_verbose) ) {
+    if ( !ble.begin(ble_verbose, false) ) {
         logger.println(F("BLE init failed"));
         while (1);
     }
-    ble.echo(false);
-
-    logger.set_ble(&ble);
 
     logger.println(F("Communications initialized"));
 
     // Initialize buffers and state
-    memset(hu_buf, 0, HU_MSG_BUF_LEN);
-    memset(bike_buf, 0, BIKE_MSG_BUF_LEN);
-    hu_buf_bytes = bike_buf_bytes = running_checksum = 0;
+    hu_frame.reset();
+    bike_frame.reset();
+    receive_state = WAITING_FOR_HU;
     last_time_messages_seen = 0;
-    boot_sequence_complete = false;
     init_ringbuf();
+    memset(&link_counters, 0, sizeof(link_counters));
+    bike_latency.reset();
+    health.initialize();
+    ble_command_len = 0;
+    last_ble_uart_poll = 0;
+    power_state = POWER_ACTIVE;
+    ride_status_log_pending = false;
+    scheduler.initialize(TASKS, NUM_TASKS);
+    #ifdef ENABLE_PROFILER
+    profiler.reset();
+    #endif
 
     resistance_lut.initialize();
-    ride_status.initialize();
+    // Carry on from the totals saved before the last reset, if any
+    ride_status.initialize(ride_log.initialize() ? &ride_log.saved : NULL);
+    output_filter.initialize();
 
     // Decide whether to use real bike or simulator
     // Simulate if requested in software or forced in hardware.
@@ -156,107 +204,170 @@ void setup() {
     if (use_simulator) EEPROM.update(EEPROM_FORCE_SIMULATION_AT_STARTUP,
                                      false);
 
-    if (LOG_LEVEL >= LOG_LEVEL_INFO) {
+    if (LOG_ENABLED(LOG_LEVEL_INFO)) {
         if (use_simulator) logger.println(F("Simulator requested, using sim"));
     }
     peloton.initialize(use_simulator);
+    select_receive_source();
 
     power_service.initialize();
+    // Log to BLE UART as well, now that the module is up
+    logger.set_ble(&ble);
 
-    // Initialize state machine
-    last_status_sent = millis() - BT_UPDATE_INTERVAL_MILLIS;
+    // From here on, logs are queued and drained between messages
+    logger.set_buffered(true);
 
     // Set LED low once bootup is complete
     digitalWrite(LED_BUILTIN, LOW);
 }
 
-bool receive_message_pair(void) {
-    bool hu_message_complete = false, bike_message_complete = false;
-    digitalWrite(PIN_STATE_READ_HU, HIGH);
-    peloton.hu_listen();
-    if (peloton.hu_available() == 0) {
-        digitalWrite(PIN_STATE_READ_HU, LOW);
-        return hu_message_complete && bike_message_complete;
+inline bool bike_timed_out(const uint16_t timestamp) {
+    // Wrap-safe comparison against the previous byte of the pair
+    return (int16_t) (timestamp - last_byte_timestamp) >
+           (int16_t) bike_latency.timeout_ticks(bike_frame.len > 0);
+}
+
+inline void reset_to_wait_for_hu(void) {
+    // The next receive pass listens to the HU again
+    hu_frame.reset();
+    bike_frame.reset();
+    receive_state = WAITING_FOR_HU;
+    scheduler.note_reply_done();
+}
+
+inline void bike_reply_timed_out(void) {
+    // Count the miss as a sample at the limit, so a limit that is too
+    // tight moves up rather than only ever seeing the replies that beat it
+    LatencyHistogram& hist = bike_latency.histogram(bike_frame.len > 0);
+    hist.record(hist.timeout_ticks);
+    link_counters.timed_out++;
+    health.bike_timeouts++;
+    reset_to_wait_for_hu();
+}
+
+/* One receive pass over a particular transport. Instantiated once per
+ * transport so the per-byte calls are inlined with no source check.
+ */
+template <class Transport> bool receive_message_pair_from(PelotonLink<Transport> peloton) {
+    peloton.poll();
+    if (receive_state == WAITING_FOR_HU) {
+        STATE_PIN_HIGH(PIN_STATE_READ_HU);
+        peloton.hu_listen();
+        // Only time passes that have bytes to handle
+        const unsigned long hu_start = micros();
+        const bool hu_pending = peloton.hu_available();
+        while (peloton.hu_available()) {
+            // Only a valid request is worth waiting for a reply to
+            const FrameStatus status = hu_frame.feed(peloton.hu_read());
+            if (status != FRAME_INCOMPLETE) capture_frame(hu_frame, peloton.hu_timestamp());
+            if (status == FRAME_INVALID) link_counters.rejected++;
+            if (status == FRAME_VALID) {
+                scheduler.note_hu_request(rx_ticks_to_micros(peloton.hu_timestamp()));
+                peloton.bike_listen();
+                bike_frame.reset();
+                last_byte_timestamp = peloton.hu_timestamp();
+                receive_state = WAITING_FOR_BIKE;
+                break;
+            }
+        }
+        STATE_PIN_LOW(PIN_STATE_READ_HU);
+        if (hu_pending) PROF_RECORD(PROF_RECEIVE_HU, micros() - hu_start);
+        if (receive_state == WAITING_FOR_HU) return false;
     }
 
-    // Read HU message
-    unsigned long receive_start;
-    while (peloton.hu_available()) {
-        receive_start = millis();
-        uint8_t next_byte = peloton.hu_read();
-        if (next_byte == 0xFE || next_byte == 0xF5 || next_byte == 0xF7 ||
-            hu_buf_bytes > (HU_MSG_BUF_LEN - 1)) {
-            // Reset - starting a new message, or overflow
-            // if this byte isn't the checksum
-            if (next_byte != running_checksum)
-                hu_buf_bytes = 0;
+    // Read bike message. Bytes are timestamped on arrival, so the
+    // timeouts below hold even if we were busy while they came in.
+    STATE_PIN_HIGH(PIN_STATE_READ_BIKE);
+    const unsigned long bike_start = micros();
+    const bool bike_pending = peloton.bike_available();
+    bool complete = false;
+    while (peloton.bike_available()) {
+        uint8_t next_byte = peloton.bike_read();
+        const uint16_t timestamp = peloton.bike_timestamp();
+        // Drop anything that arrived before this HU request finished
+        if ((int16_t) (timestamp - last_byte_timestamp) < 0) continue;
+        if (bike_timed_out(timestamp)) {
+            // Bike was too slow between bytes; give up on this pair
+            bike_reply_timed_out();
+            break;
         }
-        hu_buf[hu_buf_bytes++] = (uint8_t) next_byte;
-        running_checksum += next_byte;
-
-        if (next_byte == 0xF6) {
-            // End message
-            peloton.bike_listen();
-            digitalWrite(PIN_STATE_READ_HU, LOW);
-            digitalWrite(PIN_STATE_READ_BIKE, HIGH);
-            running_checksum = 0;
-            hu_message_complete = true;
+        bike_latency.histogram(bike_frame.len > 0).record(timestamp - last_byte_timestamp);
+        last_byte_timestamp = timestamp;
+
+        // Invalid replies still complete the pair; they are logged
+        // and otherwise ignored by process_message_pair()
+        const FrameStatus status = bike_frame.feed(next_byte);
+        if (status != FRAME_INCOMPLETE) {
+            capture_frame(bike_frame, timestamp);
+            if (status == FRAME_VALID) link_counters.accepted++;
+            else link_counters.rejected++;
+            peloton.hu_listen();
+            receive_state = WAITING_FOR_HU;
+            scheduler.note_reply_done();
+            complete = true;
             break;
         }
     }
+    // If the bike has gone quiet for too long, go back to waiting for the HU
+    if (receive_state == WAITING_FOR_BIKE && bike_timed_out(rx_ticks()))
+        bike_reply_timed_out();
+    STATE_PIN_LOW(PIN_STATE_READ_BIKE);
+    if (bike_pending) PROF_RECORD(PROF_RECEIVE_BIKE, micros() - bike_start);
+    return complete;
+}
 
-    // Read bike message with no interruptions since HU completion
-    // Enable timeout timer
-    enable_bike_timeout();
-    while (!bike_message_complete) {
-        // Wait a max of 10-11ms at each byte
-        // (might be 10 if the timer ticks over immediately after we assign)
-        bike_wait_ms_remaining = 11;
-        while (!peloton.bike_available()) {
-            // If we have waited too long for the bike to respond, bail.
-            if (bike_wait_ms_remaining == 0) {
-                disable_bike_timeout();
-                return false;
-            }
-        }
-        uint8_t next_byte = peloton.bike_read();
+bool receive_from_bike(void) {
+    return receive_message_pair_from(PelotonLink<DualSerialReceiver>(peloton_rx));
+}
 
-        if (next_byte == 0xF1 ||
-            bike_buf_bytes > (BIKE_MSG_BUF_LEN - 1)) {
-            // Reset - starting a new message; or overflow
-            // as long as this byte isn't the checksum
-            if (next_byte != running_checksum)
-                bike_buf_bytes = 0;
-        }
-        bike_buf[bike_buf_bytes++] = (uint8_t) next_byte;
-        running_checksum += next_byte;
+bool receive_from_simulator(void) {
+    return receive_message_pair_from(PelotonLink<PelotonSimulator>(peloton.simulator));
+}
 
-        if (next_byte == 0xF6) {
-            // End message
-            peloton.hu_listen();
-            digitalWrite(PIN_STATE_READ_BIKE, LOW);
-            running_checksum = 0;
-            bike_message_complete = true;
-        }
+#ifdef ENABLE_RINGBUF
+bool receive_from_replay(void) {
+    return receive_message_pair_from(PelotonLink<TraceReplay>(peloton.replay));
+}
+#endif
+
+void select_receive_source(void) {
+    // Picked once per change of source, not per byte
+    switch (peloton.source()) {
+        case SOURCE_SIMULATOR:
+            receive_message_pair = receive_from_simulator;
+            break;
+        #ifdef ENABLE_RINGBUF
+        case SOURCE_REPLAY:
+            receive_message_pair = receive_from_replay;
+            break;
+        #endif
+        default:
+            receive_message_pair = receive_from_bike;
     }
-    disable_bike_timeout();
+}
+
+/* TASKS
+ *
+ * Run by the scheduler in table order; see scheduler.h.
+ */
 
-    return hu_message_complete && bike_message_complete;
+void task_receive(void) {
+    if (receive_message_pair()) {
+        last_time_messages_seen = millis();
+        scheduler.signal(TASK_DECODE);
+    }
 }
 
-// Returns true if the message seen indicates that the bootup sequence is done.
-bool process_message_pair(void) {
-    digitalWrite(PIN_STATE_PROC_MSG, HIGH);
-    char logbuf[32];
+void task_decode(void) {
+    // Runs in the same pass as the receive that completed the pair,
+    // before the next HU request can reuse the frames
+    STATE_PIN_HIGH(PIN_STATE_PROC_MSG);
     const unsigned long process_start = micros();
-    bool updated_ride_status = false;
-    bool done_with_boot = false;
-
-    // Parse messages in the buffers
-    HUMessage hu_msg(hu_buf, hu_buf_bytes);
-    BikeMessage bike_msg(bike_buf, bike_buf_bytes);
+    char logbuf[32];
+    HUMessage hu_msg(hu_frame);
+    BikeMessage bike_msg(bike_frame);
 
-    if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
+    if (LOG_ENABLED(LOG_LEVEL_DEBUG)) {
         snprintf_P(logbuf, 32,
                    PSTR("hu valid:%hhu,bike valid:%hhu\n"),
                    (uint8_t) hu_msg.is_valid,
@@ -267,133 +378,207 @@ bool process_message_pair(void) {
 
     if (hu_msg.is_valid && bike_msg.is_valid) {
         if (hu_msg.packet_type == READ_RESISTANCE_TABLE) {
-            add_ringbuf();
             resistance_lut.update_entry(bike_msg.value, hu_msg.request);
             // Sync to EEPROM once we get all the resistance values
-            if (hu_msg.request == 0x1E) {
-                done_with_boot = true;
-                resistance_lut.sync_to_eeprom();
-                logger.print(F("Rcvd all RLUT msgs,syncing\n"));
-                resistance_lut.serial_status_text();
-            }
-
+            if (hu_msg.request == 0x1E) scheduler.signal(TASK_PERSIST);
         } else if (bike_msg.request == BIKE_ID ||
                    hu_msg.packet_type == STARTUP_UNKNOWN) {
             // Do nothing on the two startup packets
-            add_ringbuf();
-
         } else {
-            // Update internal ride status state
-            ride_status.update(bike_msg, resistance_lut);
-            updated_ride_status = true;
-            done_with_boot = true;
+            ride_metric = bike_msg;
+            scheduler.signal(TASK_RIDE);
         }
-    } else {
-        add_ringbuf();
     }
+    PROF_RECORD(PROF_PARSE, micros() - process_start);
+    STATE_PIN_LOW(PIN_STATE_PROC_MSG);
+}
 
-    // Update BLE gadget state
-    // Takes 24us + time to update GATTs = 15ms
-    const unsigned long bt_start = micros();
-    const unsigned long current_time = millis();
-    if (current_time - last_status_sent >= BT_UPDATE_INTERVAL_MILLIS) {
-        last_status_sent = current_time;
-        power_service.update(ride_status.integral_crank_revolutions(),
-                             ride_status.last_crank_rev_ts_millis(),
-                             ride_status.integral_wheel_revolutions(),
-                             ride_status.last_wheel_rev_ts_millis(),
-                             ride_status.current_watts(),
-                             ride_status.total_kj());
-    }
+void task_ride(void) {
+    PROFILE(PROF_RIDE_UPDATE, ride_status.update(ride_metric, resistance_lut));
+    output_filter.update(ride_metric.request, ride_status);
+    // Only stages the new values; task_ble() decides when they are
+    // worth notifying
+    PROFILE(PROF_BLE_UPDATE,
+            power_service.update(ride_status.integral_crank_revolutions(),
+                                 ride_status.last_crank_rev_ts_millis(),
+                                 ride_status.integral_wheel_revolutions(),
+                                 ride_status.last_wheel_rev_ts_millis(),
+                                 output_filter.watts(),
+                                 ride_status.total_kj(),
+                                 ride_status.workout_kj(),
+                                 output_filter.rpm(),
+                                 ride_status.speed_cmph(),
+                                 ride_status.resistance_percent(),
+                                 ride_status.last_sample_millis()));
+    if (LOG_ENABLED(LOG_LEVEL_INFO)) ride_status_log_pending = true;
+}
+
+void task_ble(void) {
+    // Push changed GATT values out to the BLE module a step at a time
+    PROFILE(PROF_BLE_UPDATE, power_service.service(ride_status.is_active(millis())));
+}
 
-    const unsigned long process_end = micros();
-    unsigned long log_end;
+void task_command(void) {
+    STATE_PIN_HIGH(PIN_STATE_HANDLE_CMD);
+    PROFILE(PROF_COMMAND, handle_user_command_if_available());
+    STATE_PIN_LOW(PIN_STATE_HANDLE_CMD);
+}
 
-    if (LOG_LEVEL >= LOG_LEVEL_INFO && updated_ride_status) {
-        // this call takes about 11ms in non DEBUG mode if only one print call
+void task_log(void) {
+    const unsigned long log_start = micros();
+    if (ride_status_log_pending) {
+        // Formatting only queues the text; drain() sends it a piece at a time
         serial_print_state();
+        ride_status_log_pending = false;
     }
-    if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
-        snprintf_P(logbuf, 32, PSTR("proc %luus BT %luus\n"),
-                   process_end-process_start, process_end-bt_start);
-        logger.print(logbuf);
-        log_end = micros();
-        snprintf_P(logbuf,32,PSTR("logs %luus\n"), log_end - process_end);
-        logger.print(logbuf);
+    logger.drain(LOG_DRAIN_BUDGET_MICROS);
+    PROF_RECORD(PROF_LOGGING, micros() - log_start);
+}
+
+void task_persist(void) {
+    // EEPROM writes take 3.3ms a byte, so one byte a pass as for the ride log
+    if (resistance_lut.sync_step()) {
+        scheduler.signal(TASK_PERSIST);
+        return;
     }
+    logger.print(F("Rcvd all RLUT msgs,synced\n"));
+    resistance_lut.serial_status_text();
+}
 
-    // Reset buffers
-    memset(hu_buf, 0, HU_MSG_BUF_LEN);
-    memset(bike_buf, 0, BIKE_MSG_BUF_LEN);
-    running_checksum = 0;
-    hu_buf_bytes = bike_buf_bytes = 0;
-    digitalWrite(PIN_STATE_PROC_MSG, LOW);
-    return done_with_boot;
+void task_ride_log(void) {
+    // Byte at a time, so back to back until the record is written
+    const unsigned long now = millis();
+    if (ride_log.save(ride_status.totals(), ride_status.is_active(now), now) &&
+        ride_log.write_step())
+        scheduler.signal(TASK_RIDE_LOG);
 }
 
+const char TASK_NAME_RECEIVE[] PROGMEM = "receive";
+const char TASK_NAME_DECODE[] PROGMEM = "decode";
+const char TASK_NAME_RIDE[] PROGMEM = "ride";
+const char TASK_NAME_BLE[] PROGMEM = "ble";
+const char TASK_NAME_COMMAND[] PROGMEM = "command";
+const char TASK_NAME_LOG[] PROGMEM = "log";
+const char TASK_NAME_PERSIST[] PROGMEM = "persist";
+const char TASK_NAME_RIDE_LOG[] PROGMEM = "ridelog";
+
+// Budgets are worst cases measured with the prof command; a command
+// that dumps state over serial is the longest thing we do.
+const TaskSpec TASKS[NUM_TASKS] PROGMEM = {
+    // run          period             deadline budget(us)
+    {task_receive, SCHED_EVERY_PASS,  0,    0,     TASK_NAME_RECEIVE},
+    {task_decode,  SCHED_ON_SIGNAL,   0,    0,     TASK_NAME_DECODE},
+    {task_ride,    SCHED_ON_SIGNAL,   0,    0,     TASK_NAME_RIDE},
+    {task_ble,     SCHED_EVERY_PASS,  100,  3000,  TASK_NAME_BLE},
+    {task_command, SCHED_EVERY_PASS,  1000, 20000, TASK_NAME_COMMAND},
+    {task_log,     SCHED_EVERY_PASS,  200,  LOG_DRAIN_BUDGET_MICROS + 2000, TASK_NAME_LOG},
+    {task_persist, SCHED_ON_SIGNAL,   2000, 2000,  TASK_NAME_PERSIST},
+    {task_ride_log, 1000,             1000, 200,   TASK_NAME_RIDE_LOG},
+};
+
 void loop() {
-    bool messages_available = receive_message_pair();
-    if (messages_available) {
-        last_time_messages_seen = millis();
-        boot_sequence_complete = process_message_pair();
+    scheduler.run_pass();
+
+    update_power_state();
+    if (power_state == POWER_IDLE) sleep_until_interrupt();
+    return;
+}
+
+void update_power_state(void) {
+    /* Go idle once the Peloton has been quiet for a while, and back to
+     * full rate on the first message pair; the HU polls every 100ms, so
+     * that is within one polling cycle of it waking up.
+     */
+    const unsigned long now = millis();
+    const bool quiet = (now - last_time_messages_seen > IDLE_AFTER_MILLIS &&
+                        !ride_status.is_active(now));
+    if (power_state == POWER_ACTIVE && quiet) {
+        LOG_PRINT(LOG_LEVEL_INFO, F("Idle\n"));
+        power_service.set_low_power(true);
+        power_state = POWER_IDLE;
+    } else if (power_state == POWER_IDLE && !quiet) {
+        power_service.set_low_power(false);
+        LOG_PRINT(LOG_LEVEL_INFO, F("Active\n"));
+        power_state = POWER_ACTIVE;
     }
+}
 
-    // During bootup, we really don't want to miss a message by handling a command,
-    // so only accept commands during the first half of the 200ms inter-message
-    // timing if we've started seeing the boot sequence.
-    // After bootup, it's not *that* critical if we drop a message, since we'll
-    // see it again in 300ms, so accept commands whenever.
-
-    bool ok_to_process_commands = (
-        boot_sequence_complete
-        || last_time_messages_seen == 0     // We haven't seen start of boot sequence
-        || (millis() - last_time_messages_seen < 100 && last_time_messages_seen != 0));
-
-    if (ok_to_process_commands) {
-        digitalWrite(PIN_STATE_HANDLE_CMD, HIGH);
-        handle_user_command_if_available();
-        digitalWrite(PIN_STATE_HANDLE_CMD, LOW);
+void sleep_until_interrupt(void) {
+    /* Idle sleep keeps Timer1 and the pin-change interrupt running, so
+     * the Peloton lines are still decoded exactly while asleep. Anything
+     * wakes the CPU: an RX pin-change edge, USB, or the 1ms millis()
+     * tick, which bounds how long a sleep can last. The BLE IRQ is not a
+     * wake source; the module only raises it in answer to a query, and
+     * the idle poll of the UART runs off the tick.
+     */
+    if (peloton.source() != SOURCE_BIKE || !logger.idle()) return;
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    cli();
+    // Don't sleep on bytes that arrived since this pass checked
+    if (peloton_rx.hu.available() || peloton_rx.bike.available()) {
+        sei();
+        return;
     }
-    return;
+    sleep_enable();
+    // The instruction after sei() always runs, so no wakeup is missed
+    sei();
+    sleep_cpu();
+    sleep_disable();
 }
 
 void serial_print_state(void) {
     ride_status.serial_status_text();
-    if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
+    if (LOG_ENABLED(LOG_LEVEL_DEBUG)) {
         resistance_lut.serial_status_text();
         power_service.serial_status_text();
     }
 }
 
 void handle_user_command_if_available() {
-    const uint8_t buflen = 32;
-    char cmdbuf[buflen];
-    bool command_available = (read_BLE_command(cmdbuf, buflen) ||
+    ScratchBuffer scratch(32);
+    const uint8_t buflen = scratch.len;
+    char* const cmdbuf = scratch.data;
+    // Reading BLE UART would have to wait out a pending GATT update,
+    // so leave it for the next pass
+    bool command_available = ((!ble.atcommand_pending() &&
+                               read_BLE_command(cmdbuf, buflen)) ||
                               read_serial_command(cmdbuf, buflen));
-    if (command_available) run_command(cmdbuf);
+    if (command_available) {
+        // Command output is usually longer than the log ring, so write it
+        // straight through
+        logger.set_buffered(false);
+        run_command(cmdbuf);
+        logger.set_buffered(true);
+    }
 }
 
 bool read_BLE_command(char *cmdbuf, const uint8_t buflen) {
-    const unsigned long prev_timeout = ble.getTimeout();
-    char* res = NULL;
-    int rxlen;
-
-    // Wait no more than 3ms for data to come in.
-    // At 1ms, reception is unreliable. Allow a little buffer.
-    // (For the same reason, available() on the BLEUart isn't great.)
-    ble.setTimeout(3);
-
-    while (NULL == res) {
-        rxlen = ble.readBLEUart(cmdbuf, buflen);
-        if (rxlen == 0) break;
-        res = memchr(cmdbuf, '\n', buflen);
+    const unsigned long now = millis();
+    const unsigned long interval = (power_state == POWER_IDLE ?
+                                    BLE_UART_IDLE_POLL_INTERVAL_MILLIS :
+                                    BLE_UART_POLL_INTERVAL_MILLIS);
+    if (now - last_ble_uart_poll < interval) return false;
+    last_ble_uart_poll = now;
+
+    // One round trip to the module; no read timeout to wait out
+    const uint8_t rxlen = ble.pollBLEUart((uint8_t*) ble_command_line + ble_command_len,
+                                          sizeof(ble_command_line) - ble_command_len);
+    if (rxlen == 0) return false;
+    ble_command_len += rxlen;
+    char* res = (char*) memchr(ble_command_line, '\n', ble_command_len);
+    if (NULL == res) {
+        // A line longer than any command is never going to parse
+        if (ble_command_len == sizeof(ble_command_line)) ble_command_len = 0;
+        return false;
     }
-    // Restore previous timeout setting
-    ble.setTimeout(prev_timeout);
-    if (rxlen == 0 && NULL == res) return false;
-    // Null terminate at newline
-    *res = '\0';
-    logger.println(res);
+    // Hand over the line up to the newline, keep whatever followed it
+    const uint8_t line_len = res - ble_command_line;
+    const uint8_t copy_len = MIN(line_len, buflen - 1);
+    memcpy(cmdbuf, ble_command_line, copy_len);
+    cmdbuf[copy_len] = '\0';
+    ble_command_len -= line_len + 1;
+    memmove(ble_command_line, res + 1, ble_command_len);
+    logger.println(cmdbuf);
     return true;
 }
 
@@ -428,9 +613,20 @@ void run_command(const char* const cmdbuf) {
             "\tdebug\t log level DEBUG\n"
             "\trlut\tdump resistance LUT\n"
             "\tble\tdump BLE module state\n"
+            "\tsvc\t[ftms|all] BLE services, reboots\n"
             "\tride\tdump ride state\n"
+            "\trclr\tclear saved ride totals\n"
+            "\tstress\t[ms [fault%]|off] sim stress test\n"
+            "\tsched\tdump task scheduler\n"
+            "\tstats\tdump link health counters\n"
+            "\tmem\tdump SRAM use\n"
+            #ifdef ENABLE_PROFILER
+            "\tprof\tdump loop profile, bike latency\n"
+            "\tprofclr\treset loop profile\n"
+            #endif
             #ifdef ENABLE_RINGBUF
-            "\tring\tdump bootup ring buffer\n"
+            "\tring\tdump captured frames (binary)\n"
+            "\treplay\tstart/stop replaying captured frames\n"
             #endif
         ));
     }
@@ -453,8 +649,12 @@ void run_command(const char* const cmdbuf) {
         logger.println(F("Logs->INFO"));
         LOG_LEVEL = LOG_LEVEL_INFO;
     } else if (strncmp_P(cmdbuf,PSTR("debug"),5) == 0) {
-        logger.println(F("Logs->DEBUG"));
-        LOG_LEVEL = LOG_LEVEL_DEBUG;
+        if (LOG_LEVEL_COMPILED >= LOG_LEVEL_DEBUG) {
+            logger.println(F("Logs->DEBUG"));
+            LOG_LEVEL = LOG_LEVEL_DEBUG;
+        } else {
+            logger.println(F("DEBUG logs not built"));
+        }
     } else if (strncmp_P(cmdbuf,PSTR("nolog"),5) == 0) {
         logger.println(F("Logs->NONE"));
         LOG_LEVEL = LOG_LEVEL_NONE;
@@ -468,36 +668,153 @@ void run_command(const char* const cmdbuf) {
         LOG_LEVEL = LOG_LEVEL_MAX;
         power_service.serial_status_text();
         LOG_LEVEL = prev_log_level;
+    } else if (strncmp_P(cmdbuf, PSTR("svc"), 3) == 0) {
+        run_services_command(cmdbuf + 3);
     } else if (strncmp_P(cmdbuf, PSTR("ride"), 4) == 0) {
         LOG_LEVEL = LOG_LEVEL_MAX;
         ride_status.serial_status_text();
+        ride_log.serial_status_text(logger);
         LOG_LEVEL = prev_log_level;
+    } else if (strncmp_P(cmdbuf, PSTR("rclr"), 4) == 0) {
+        ride_log.erase();
+        ride_status.initialize();
+        output_filter.initialize();
+        logger.println(F("Ride totals cleared"));
+    }
+    //  SIMULATOR STRESS TEST
+    else if (strncmp_P(cmdbuf, PSTR("stress"), 6) == 0) {
+        run_stress_command(cmdbuf + 6);
+    } else if (strncmp_P(cmdbuf, PSTR("sched"), 5) == 0) {
+        scheduler.dump(logger);
+    } else if (strncmp_P(cmdbuf, PSTR("mem"), 3) == 0) {
+        serial_memory_report();
+    } else if (strncmp_P(cmdbuf, PSTR("stats"), 5) == 0) {
+        health.collect(hu_frame.counters, bike_frame.counters, peloton.overflows(),
+                       power_service.notify_error_count(), scheduler.total_overruns());
+        health.dump(logger, logger.dropped_bytes());
     }
+    #ifdef ENABLE_PROFILER
+    else if (strncmp_P(cmdbuf, PSTR("profclr"), 7) == 0) {
+        profiler.reset();
+        logger.println(F("Profile cleared"));
+    } else if (strncmp_P(cmdbuf, PSTR("prof"), 4) == 0) {
+        profiler.dump(logger);
+        bike_latency.dump(logger, link_counters.timed_out);
+    }
+    #endif
     #ifdef ENABLE_RINGBUF
     else if (strncmp_P(cmdbuf, PSTR("ring"), 4) == 0) {
-            dump_ringbuf();
+        dump_ringbuf();
+    } else if (strncmp_P(cmdbuf, PSTR("replay"), 6) == 0) {
+        if (peloton.is_replaying()) {
+            peloton.stop_replay();
+            select_receive_source();
+            reset_to_wait_for_hu();
+            logger.println(F("Replay stopped"));
+        } else if (peloton.start_replay()) {
+            select_receive_source();
+            reset_to_wait_for_hu();
+            logger.println(F("Replaying capture"));
+        } else {
+            logger.println(F("Nothing captured"));
+        }
     }
     #endif
 
     return;
 }
 
-void serial_log_messagepair_text(void) {
-    const int buf_len = 16 + 3 + BIKE_MSG_BUF_LEN * 3 + 1;
-    char buf[16 + 3 + BIKE_MSG_BUF_LEN * 3 + 1];
-    uint8_t base = 0;
-    uint8_t len;
-    len = snprintf_P(buf + base, buf_len - base,
-                     PSTR("\n\t%02hhX %02hhX %02hhX %02hhX\n%d\t"),
-                     hu_buf[0], hu_buf[1], hu_buf[2], hu_buf[3], bike_buf_bytes);
-    base = MIN(buf_len, base + len);
-    for (uint8_t i = 0; i < bike_buf_bytes; i++) {
-        snprintf_P(buf + base, buf_len - base, PSTR("%02hhX "), bike_buf[i]);
-        base = MIN(buf_len, base + 3);
+void serial_stress_report(void) {
+    char buf[64];
+    const unsigned long elapsed = millis() - link_counters.since;
+    // Pairs per second, in tenths; 32 bits is plenty for a test run
+    const uint32_t rate = elapsed >= 100 ? link_counters.accepted * 100 / (elapsed / 100) : 0;
+    snprintf_P(buf, 64, PSTR("every %ums, %u%% faults, %lus\n"),
+               peloton.simulator.message_interval, peloton.simulator.fault_percent,
+               elapsed / 1000);
+    logger.print(buf);
+    snprintf_P(buf, 64, PSTR("offered %lu accepted %lu\n"),
+               peloton.simulator.requests_offered, link_counters.accepted);
+    logger.print(buf);
+    snprintf_P(buf, 64, PSTR("rejected %lu timed out %lu\n"),
+               link_counters.rejected, link_counters.timed_out);
+    logger.print(buf);
+    snprintf_P(buf, 64, PSTR("%lu.%lu pairs/s\n"), rate / 10, rate % 10);
+    logger.print(buf);
+}
+
+void run_stress_command(const char* args) {
+    /* stress                  report counters
+     * stress <ms> [fault%]    poll every <ms> (0 = as fast as we keep up)
+     *                         and corrupt fault% of the bike's replies
+     * stress off              back to the normal simulator
+     */
+    if (peloton.source() != SOURCE_SIMULATOR) {
+        logger.println(F("Stress needs the simulator"));
+        return;
     }
-    if (base < buf_len - 1) {
-        buf[base] = '\n';
-        buf[base + 1] = '\0';
+    while (*args == ' ') args++;
+    if (*args == '\0') {
+        serial_stress_report();
+        return;
     }
+    if (strncmp_P(args, PSTR("off"), 3) == 0) {
+        peloton.simulator.set_stress(SIMULATOR_MESSAGE_INTERVAL_MILLIS, 0);
+        logger.println(F("Stress off"));
+    } else {
+        char* rest;
+        const unsigned long interval = strtoul(args, &rest, 10);
+        const unsigned long faults = strtoul(rest, NULL, 10);
+        peloton.simulator.set_stress(MIN(interval, 0xFFFFUL), MIN(faults, 100UL));
+        logger.println(F("Stress on"));
+    }
+    memset(&link_counters, 0, sizeof(link_counters));
+    link_counters.since = millis();
+}
+
+void serial_memory_report(void) {
+    char buf[48];
+    snprintf_P(buf, 48, PSTR("static %u, free now %u\n"),
+               sram_static_size(), sram_free_now());
     logger.print(buf);
+    snprintf_P(buf, 48, PSTR("stack peak %u, never used %u\n"),
+               sram_stack_peak(), sram_never_used());
+    logger.print(buf);
+    snprintf_P(buf, 48, PSTR("scratch peak %u/%u, short %u\n"),
+               scratch_arena.peak, SCRATCH_ARENA_LEN, scratch_arena.shortfalls);
+    logger.print(buf);
+}
+
+void run_services_command(const char* args) {
+    /* svc          show which BLE services are offered
+     * svc ftms     Fitness Machine only
+     * svc all      Fitness Machine, Cycling Power and Speed/Cadence
+     */
+    while (*args == ' ') args++;
+    uint8_t services;
+    if (strncmp_P(args, PSTR("ftms"), 4) == 0) {
+        services = BLE_SERVICES_FTMS_ONLY;
+    } else if (strncmp_P(args, PSTR("all"), 3) == 0) {
+        services = BLE_SERVICES_ALL;
+    } else {
+        if (BLECyclingPower::stored_services() == BLE_SERVICES_ALL)
+            logger.println(F("BLE: FTMS+CP+CSC"));
+        else
+            logger.println(F("BLE: FTMS"));
+        return;
+    }
+    BLECyclingPower::store_services(services);
+    logger.println(F("Rebooting..."));
+    logger.flush();
+    reboot();
+}
+
+void serial_log_messagepair_text(void) {
+    ScratchBuffer scratch(16 + 3 + BIKE_MSG_BUF_LEN * 3 + 1);
+    Formatter f(scratch.data, scratch.len);
+    f.str_P(PSTR("\n\t")).hex8(hu_frame.buf[0]).chr(' ').hex8(hu_frame.buf[1])
+     .chr(' ').hex8(hu_frame.buf[2]).chr(' ').hex8(hu_frame.buf[3])
+     .chr('\n').dec(bike_frame.len).chr('\t');
+    for (uint8_t i = 0; i < bike_frame.len; i++) f.hex8(bike_frame.buf[i]).chr(' ');
+    logger.print(f.chr('\n').c_str());
 }
@@ -10,50 +10,7 @@
  */
 #ifndef _PELOTON_H_
 #define _PELOTON_H_
-#include <SoftwareSerial.h>
-bool message_is_valid(uint8_t* msg, uint8_t len);
-bool message_is_valid(uint8_t* msg, uint8_t len) {
-    // Peloton messages always end in F6
-    if (msg[len-1] != 0xF6) {
-        if (LOG_LEVEL >= LOG_LEVEL_DEBUG)
-            Serial.println(F("Invalid terminator"));
-        return false;
-    }
-
-    // First byte is always F5 / FE / F7 (head unit) or F1 (bike)
-    // F5 and F1 are the ones used during rides and are frequent so
-    // put them first in check.
-    if (! (msg[0] == 0xF5 || msg[0] == 0xF1 ||
-           msg[0] == 0xF7 || msg[0] == 0xFE)) {
-        if (LOG_LEVEL >= LOG_LEVEL_DEBUG) Serial.println(F("Invalid header"));
-        return false;
-    }
-
-    // Verify length
-    if (msg[0] == 0xF1) {
-        if (msg[2] + 5 != len) {
-            if (LOG_LEVEL >= LOG_LEVEL_DEBUG) Serial.println(F("Invalid length F1"));
-            return false;
-        }
-    } else if (msg[0] == 0xF5 || msg[0] == 0xFE || msg[0] == 0xF7) {
-        if (len != 4) {
-            if (LOG_LEVEL >= LOG_LEVEL_DEBUG) {
-                Serial.print(F("Invalid length HU "));
-                Serial.println(len);
-            } 
-            return false;
-        }
-    }
-
-    // Verify checksum
-    uint8_t checksum = 0;
-    for (uint8_t i = 0; i < len-2; checksum += msg[i++]);
-    if (checksum != msg[len-2]) return false;
-
-    return true;
-}
-
-
+#include "dual_serial.h"
 class PelotonSimulator;
 enum HUPacketType {
     STARTUP_UNKNOWN = 0xFE,
@@ -83,38 +40,196 @@ enum Requests {
                RESISTANCE_TABLE_RESPONSE = 0xF7,
                BIKE_ID = 0xFB,
                UNKNOWN_INIT_REQUEST = 0xFE};
-class BikeMessage {
+#define HU_MSG_BUF_LEN 4
+#define BIKE_MSG_BUF_LEN 15
+
+enum FrameStatus {
+    FRAME_INCOMPLETE,
+    FRAME_VALID,
+    FRAME_INVALID
+};
+
+/* Frames seen by a decoder since boot, by outcome. Counters wrap at 16
+ * bits; readers take differences.
+ */
+struct FrameCounters {
+    uint16_t frames;            // valid
+    uint16_t skipped;           // bytes outside any frame
+    uint16_t truncated;         // cut short by the next header
+    uint16_t bad_length;        // too long for the buffer
+    uint16_t bad_checksum;
+    uint16_t bad_digits;        // payload not a 16 bit decimal
+    uint16_t bad_terminator;
+
+    uint16_t errors() const {
+        return truncated + bad_length + bad_checksum + bad_digits + bad_terminator;
+    }
+};
+
+/* Single-pass decoder for Peloton frames.
+ *
+ * Bytes are fed in one at a time as they come off the wire. Header,
+ * length and checksum are validated as they arrive and the reversed
+ * ASCII payload of bike messages is accumulated into an integer on
+ * the way, so a frame is fully decoded when its F6 terminator lands.
+ * The raw bytes are kept in buf for logging.
+ */
+class FrameDecoder {
     public:
-    Requests request;
-    uint16_t value;
-    bool is_valid;
-    // Only parse valid messages _from the bike_, not the HU
-    BikeMessage(uint8_t* bike_msg, const uint8_t len) {
-        request = 0;
+    uint8_t buf[BIKE_MSG_BUF_LEN];
+    uint8_t len;
+    uint16_t value;     // decoded payload of the last bike frame
+    bool valid;         // whether the last terminated frame was valid
+    FrameCounters counters;
+
+    FrameDecoder(const bool from_bike_): from_bike(from_bike_) {
+        reset();
+        counters = FrameCounters();
+    }
+    void reset() {
+        state = SEEK_HEADER;
+        len = 0;
+        checksum = 0;
         value = 0;
-        if (!message_is_valid(bike_msg, len) || bike_msg[0] != 0xF1) {
-            is_valid = false;
-            return;
+        valid = false;
+    }
+    uint8_t header() const {
+        return buf[0];
+    }
+    uint8_t request() const {
+        return buf[1];
+    }
+    bool in_frame() const {
+        // A header has been seen and the frame isn't finished
+        return state != SEEK_HEADER;
+    }
+    FrameStatus feed(const uint8_t next_byte) {
+        if (state != EXPECT_CHECKSUM && is_header(next_byte)) {
+            // Start of a new frame. If we were in the middle of
+            // one it has been truncated.
+            if (state != SEEK_HEADER) counters.truncated++;
+            start_frame(next_byte);
+            return FRAME_INCOMPLETE;
         }
-        request = bike_msg[1];
-        if (request == BIKE_ID) {
-            is_valid = true;
-            value = 0;
-            return;
+        switch (state) {
+            case SEEK_HEADER:
+                counters.skipped++;
+                return FRAME_INCOMPLETE;
+            case EXPECT_REQUEST:
+                append(next_byte);
+                // Bike ID is not a number; don't try to parse it
+                parse_digits = (next_byte != BIKE_ID);
+                state = from_bike ? EXPECT_LENGTH : EXPECT_CHECKSUM;
+                return FRAME_INCOMPLETE;
+            case EXPECT_LENGTH:
+                if (next_byte > BIKE_MSG_BUF_LEN - 5) {
+                    counters.bad_length++;
+                    state = SEEK_HEADER;
+                    return FRAME_INCOMPLETE;
+                }
+                append(next_byte);
+                payload_remaining = next_byte;
+                state = payload_remaining ? EXPECT_PAYLOAD : EXPECT_CHECKSUM;
+                return FRAME_INCOMPLETE;
+            case EXPECT_PAYLOAD:
+                append(next_byte);
+                if (parse_digits) accumulate_digit(next_byte - 0x30);
+                if (--payload_remaining == 0) state = EXPECT_CHECKSUM;
+                return FRAME_INCOMPLETE;
+            case EXPECT_CHECKSUM:
+                // Checksum covers everything before it
+                if (next_byte != checksum) ok = false;
+                append(next_byte);
+                state = EXPECT_TERMINATOR;
+                return FRAME_INCOMPLETE;
+            case EXPECT_TERMINATOR:
+                state = SEEK_HEADER;
+                if (next_byte != 0xF6) {
+                    counters.bad_terminator++;
+                    return FRAME_INCOMPLETE;
+                }
+                append(next_byte);
+                valid = ok;
+                if (!ok) {
+                    // A bad checksum likely explains bad digits too
+                    if (buf[len - 2] != (uint8_t) (checksum - buf[len - 2] - 0xF6))
+                        counters.bad_checksum++;
+                    else
+                        counters.bad_digits++;
+                    return FRAME_INVALID;
+                }
+                counters.frames++;
+                return FRAME_VALID;
         }
-        const uint8_t payload_length = bike_msg[2];
-        for (uint8_t i = 2 + payload_length; i > 2; i--) {
-            // -30 = Convert from ASCII to numeric
-            uint8_t next_digit = bike_msg[i] - 0x30;
-            // Check for overflow
-            if (value > 6553 || (value == 6553 && next_digit > 5)) {
-                is_valid = false;
-                return;
-            }
-            value = value * 10 + next_digit;
+        return FRAME_INCOMPLETE;
+    }
+
+    private:
+    enum DecoderState {
+        SEEK_HEADER,
+        EXPECT_REQUEST,
+        EXPECT_LENGTH,
+        EXPECT_PAYLOAD,
+        EXPECT_CHECKSUM,
+        EXPECT_TERMINATOR
+    };
+    const bool from_bike;
+    uint8_t state;
+    uint8_t checksum;
+    uint8_t payload_remaining;
+    uint8_t digits;
+    uint16_t place_value;
+    bool parse_digits;
+    bool ok;
+
+    inline bool is_header(const uint8_t b) const {
+        // F5 and F1 are the ones used during rides so check them first
+        if (from_bike) return b == 0xF1;
+        return b == 0xF5 || b == 0xF7 || b == 0xFE;
+    }
+    inline void start_frame(const uint8_t b) {
+        buf[0] = b;
+        len = 1;
+        checksum = b;
+        value = 0;
+        digits = 0;
+        place_value = 1;
+        ok = true;
+        valid = false;
+        state = EXPECT_REQUEST;
+    }
+    inline void append(const uint8_t b) {
+        buf[len++] = b;
+        checksum += b;
+    }
+    inline void accumulate_digit(const uint8_t digit) {
+        // Payload is ASCII decimal, least significant digit first.
+        // Anything that isn't a digit or doesn't fit in 16 bits
+        // invalidates the frame.
+        if (digit > 9) {
+            ok = false;
+        } else if (digits < 4) {
+            value += digit * place_value;
+            place_value *= 10;
+        } else if (digits == 4) {
+            if (digit > 6 || (digit == 6 && value > 5535)) ok = false;
+            else value += digit * 10000U;
+        } else if (digit != 0) {
+            ok = false;
         }
-        is_valid = true;
-        return;
+        digits++;
+    }
+};
+
+class BikeMessage {
+    public:
+    Requests request;
+    uint16_t value;
+    bool is_valid;
+    BikeMessage(const FrameDecoder& frame) {
+        is_valid = frame.valid;
+        request = (Requests) frame.request();
+        value = frame.value;
     }
     uint8_t encode(uint8_t* buffer, const uint8_t buffer_len) {
         // To be implemented
@@ -126,15 +241,10 @@ class HUMessage {
     HUPacketType packet_type;
     Requests request;
     bool is_valid;
-    HUMessage(uint8_t* hu_msg, const uint8_t len) {
-        if (!message_is_valid(hu_msg, len) ||
-            !(hu_msg[0] == 0xF5 || hu_msg[0] == 0xF7 || hu_msg[0] == 0xFE)) {
-            is_valid = false;
-            return;
-        }
-        packet_type = hu_msg[0];
-        request = hu_msg[1];
-        is_valid = true;
+    HUMessage(const FrameDecoder& frame) {
+        is_valid = frame.valid;
+        packet_type = (HUPacketType) frame.header();
+        request = (Requests) frame.request();
     }
 };
 class SimulatedSerial {
@@ -143,12 +253,14 @@ class SimulatedSerial {
         uint8_t len;
         uint8_t loc;
         uint8_t id;
+        uint16_t pushed_at;
         PelotonSimulator* simulator;
     public:
     SimulatedSerial(const uint8_t id_, PelotonSimulator* psim): id(id_), simulator(psim) {
     }
     void begin(const int rate) {
         len = loc = 0;
+        pushed_at = 0;
         return;
     }
     void listen();
@@ -165,6 +277,10 @@ class SimulatedSerial {
         memcpy(buf, msg, nbytes);
         loc = 0;
         len = nbytes;
+        pushed_at = rx_ticks();
+    }
+    uint16_t timestamp() const {
+        return pushed_at;
     }
 };
 
@@ -181,13 +297,42 @@ class PelotonSimulator {
     SimulatedSerial hu, bike;
     uint8_t next_message_to_send;
     uint32_t last_hu_timestamp;
+    // Running sum of RESISTANCE_LUT_DELTA_ENCODED up to the table
+    // entry last sent; the table is always read in order.
+    uint16_t resistance_sum;
+
+    // Stress mode: poll interval for ride metrics, and the share of bike
+    // replies (in percent) sent with a bad checksum or cut short.
+    uint16_t message_interval;
+    uint8_t fault_percent;
+    uint16_t fault_state;       // xorshift state for choosing faults
+    uint32_t requests_offered;
 
     PelotonSimulator(): hu(0, this), bike(1, this),
                         next_message_to_send(UNKNOWN_INIT_REQUEST),
-                        last_hu_timestamp(0) {
+                        last_hu_timestamp(0), resistance_sum(0),
+                        message_interval(SIMULATOR_MESSAGE_INTERVAL_MILLIS),
+                        fault_percent(0), fault_state(0xACE1),
+                        requests_offered(0) {
     };
+    void set_stress(const uint16_t interval, const uint8_t faults) {
+        message_interval = interval;
+        fault_percent = faults > 100 ? 100 : faults;
+        requests_offered = 0;
+    }
+    bool inject_fault() {
+        if (!fault_percent) return false;
+        fault_state ^= fault_state << 7;
+        fault_state ^= fault_state >> 9;
+        fault_state ^= fault_state << 8;
+        return (fault_state % 100) < fault_percent;
+    }
+    inline void poll() {
+        // Messages are generated on listen()
+        return;
+    }
     void updateState(const uint8_t bike_listening) {
-        uint8_t msg[15];
+        uint8_t msg[15] = {0};
         uint32_t current_time = millis();
         char logbuf[32];
         if (!bike_listening) {
@@ -200,7 +345,7 @@ class PelotonSimulator {
             if (next_message_to_send == RPM || next_message_to_send == POWER ||
                 next_message_to_send == RESISTANCE) {
                 send_message = (current_time - last_hu_timestamp >=
-                                SIMULATOR_MESSAGE_INTERVAL_MILLIS);
+                                message_interval);
             }
             if (!send_message) return;
 
@@ -227,6 +372,7 @@ class PelotonSimulator {
             }
             hu.push(msg, 4);
             last_hu_timestamp = current_time;
+            requests_offered++;
         } else {
             // State machine expects message from bike
             // If bike already has a message in buffer don't push another
@@ -245,11 +391,10 @@ class PelotonSimulator {
                 next_message_to_send = READ_RESISTANCE_TABLE_00;
             } else if (next_message_to_send >= READ_RESISTANCE_TABLE_00 &&
                        next_message_to_send <= READ_RESISTANCE_TABLE_1E) {
-                uint16_t resistance = 0;
-                for (uint8_t i = READ_RESISTANCE_TABLE_00; i <= next_message_to_send; i++) {
-                    resistance += (uint8_t) pgm_read_byte(RESISTANCE_LUT_DELTA_ENCODED +
-                                                          (i - READ_RESISTANCE_TABLE_00));
-                }
+                if (next_message_to_send == READ_RESISTANCE_TABLE_00) resistance_sum = 0;
+                resistance_sum += (uint8_t) pgm_read_byte(RESISTANCE_LUT_DELTA_ENCODED +
+                                                          (next_message_to_send - READ_RESISTANCE_TABLE_00));
+                const uint16_t resistance = resistance_sum;
                 msg[1] = 0xF7;
                 msg[2] = 4;
                 msg[3] = 0x30 + resistance % 10;
@@ -292,7 +437,14 @@ class PelotonSimulator {
             for (uint8_t i=0; i < msg[2]+3; checksum += msg[i++]);
             msg[msg[2] + 3] = checksum;
             msg[msg[2] + 4] = 0xF6;
-            bike.push(msg, msg[2] + 5);
+            uint8_t nbytes = msg[2] + 5;
+            if (inject_fault()) {
+                // Alternate between a corrupt checksum and a reply
+                // that stops before its checksum and terminator
+                if (fault_state & 0x100) msg[msg[2] + 3] ^= 0x55;
+                else nbytes -= 2;
+            }
+            bike.push(msg, nbytes);
             if (0) {
                 Serial.print(F("Simulator pushing to bike "));
                 snprintf_P(logbuf, 32,
@@ -317,51 +469,109 @@ void SimulatedSerial::listen() {
    simulator->updateState(id);
    return;
 }
+#include "ringbuf.h"
+
+enum PelotonSource {
+    SOURCE_BIKE,
+    SOURCE_SIMULATOR,
+    SOURCE_REPLAY
+};
+
+/* Per-byte access to one transport. Each transport (DualSerialReceiver,
+ * PelotonSimulator, TraceReplay) has hu and bike channels with the same
+ * listen/available/read/timestamp interface and a poll() run once per
+ * receive pass, so code templated on PelotonLink compiles down to direct
+ * calls with no branch on the source per byte.
+ */
+template <class Transport>
+class PelotonLink {
+    public:
+    Transport& transport;
+
+    PelotonLink(Transport& transport_): transport(transport_) {}
+    inline void poll() {
+        transport.poll();
+    }
+    inline void hu_listen() {
+        STATE_PIN_HIGH(PIN_STATE_LISTEN_HU);
+        STATE_PIN_LOW(PIN_STATE_LISTEN_BIKE);
+        transport.hu.listen();
+    }
+    inline void bike_listen() {
+        STATE_PIN_LOW(PIN_STATE_LISTEN_HU);
+        STATE_PIN_HIGH(PIN_STATE_LISTEN_BIKE);
+        transport.bike.listen();
+    }
+    inline int8_t hu_available() {
+        return transport.hu.available();
+    }
+    inline int8_t bike_available() {
+        return transport.bike.available();
+    }
+    inline uint8_t hu_read() {
+        return transport.hu.read();
+    }
+    inline uint8_t bike_read() {
+        return transport.bike.read();
+    }
+    // rx_ticks() (64us units) at which the last byte read was received;
+    // convert with rx_ticks_to_millis() or rx_ticks_to_micros()
+    inline uint16_t hu_timestamp() {
+        return transport.hu.timestamp();
+    }
+    inline uint16_t bike_timestamp() {
+        return transport.bike.timestamp();
+    }
+};
+
+/* Owns the transports and tracks which one is live. The caller picks
+ * its receive path from source() once, when the source changes, rather
+ * than on every byte.
+ */
 class PelotonProxy {
-    private:
+    public:
     PelotonSimulator simulator;
-    SoftwareSerial hw_hu;
-    SoftwareSerial hw_bike;
-    bool use_simulator;
+    #ifdef ENABLE_RINGBUF
+    TraceReplay replay;
+    #endif
+
+    private:
+    uint8_t source_;
+    uint8_t live_source;    // source to go back to after a replay
 
     public:
-    PelotonProxy() : hw_hu(PIN_RX_FROM_HU, PIN_TX_TO_HU,
-                             INVERT_PELOTON_SERIAL),
-                       hw_bike(PIN_RX_FROM_BIKE, PIN_TX_TO_BIKE,
-                               INVERT_PELOTON_SERIAL)
-    {}
+    PelotonProxy() {}
     void initialize(bool select_simulator) {
-        use_simulator = select_simulator;
-        hw_bike.begin(19200);
-        hw_hu.begin(19200);
-    }
-    void hu_listen() {
-        digitalWrite(PIN_STATE_LISTEN_HU, HIGH);
-        digitalWrite(PIN_STATE_LISTEN_BIKE, LOW);
-        if (use_simulator) simulator.hu.listen();
-        else hw_hu.listen();
-    }
-    void bike_listen() {
-        digitalWrite(PIN_STATE_LISTEN_HU, LOW);
-        digitalWrite(PIN_STATE_LISTEN_BIKE, HIGH);
-        if (use_simulator) simulator.bike.listen();
-        else hw_bike.listen();
-    }
-    int8_t hu_available() {
-        if (use_simulator) return simulator.hu.available();
-        else return hw_hu.available();
-    }
-    int8_t bike_available() {
-        if (use_simulator) return simulator.bike.available();
-        else return hw_bike.available();
-    }
-    uint8_t hu_read() {
-        if (use_simulator) return simulator.hu.read();
-        else return hw_hu.read();
-    }
-    uint8_t bike_read() {
-        if (use_simulator) return simulator.bike.read();
-        else return hw_bike.read();
+        source_ = live_source = select_simulator ? SOURCE_SIMULATOR : SOURCE_BIKE;
+        if (source_ == SOURCE_SIMULATOR) {
+            simulator.hu.begin(19200);
+            simulator.bike.begin(19200);
+        } else {
+            peloton_rx.begin();
+        }
+    }
+    uint8_t source() const {
+        return source_;
+    }
+    #ifdef ENABLE_RINGBUF
+    bool start_replay() {
+        if (source_ == SOURCE_REPLAY || peloton_capture.empty()) return false;
+        replay.begin(peloton_capture);
+        source_ = SOURCE_REPLAY;
+        return true;
+    }
+    void stop_replay() {
+        if (source_ != SOURCE_REPLAY) return;
+        replay.end(peloton_capture);
+        source_ = live_source;
+    }
+    #endif
+    bool is_replaying() const {
+        return source_ == SOURCE_REPLAY;
+    }
+    uint16_t overflows() const {
+        if (source_ != SOURCE_BIKE) return 0;
+        return peloton_rx.hu.overflow_count() + peloton_rx.bike.overflow_count();
     }
 };
 #endif
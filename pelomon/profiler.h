@@ -0,0 +1,130 @@
+/* Per-phase loop profiler and fast state pin writes.
+ *
+ * Each phase of the main loop records how long it took in micros().
+ * A small static table keeps the count, total, min and max for each
+ * phase, plus a histogram in power-of-two buckets, and the prof command
+ * dumps it. Time spent polling with nothing to do is not recorded for
+ * the receive phases, so their figures cover actual frame handling.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+// State pins are written straight to their port; digitalWrite() takes
+// several microseconds to look up the pin every time.
+#define STATE_PIN_HIGH(pin) (pin##_PORT |= _BV(pin##_BIT))
+#define STATE_PIN_LOW(pin) (pin##_PORT &= ~_BV(pin##_BIT))
+
+enum ProfilePhase {
+    PROF_RECEIVE_HU,
+    PROF_RECEIVE_BIKE,
+    PROF_PARSE,
+    PROF_RIDE_UPDATE,
+    PROF_BLE_UPDATE,
+    PROF_COMMAND,
+    PROF_LOGGING,
+    PROF_NUM_PHASES
+};
+
+#ifdef ENABLE_PROFILER
+/* Bucket 0 is anything under 16us (micros() only ticks every 8us at
+ * 8MHz), bucket i covers [8 << i, 16 << i) and the last one everything
+ * from 16ms up. Bucket counts saturate; the totals do not.
+ */
+#define PROF_NUM_BUCKETS 12
+#define PROF_FIRST_BUCKET_LOG2 4
+
+const char PROF_NAME_RECEIVE_HU[] PROGMEM = "rx hu";
+const char PROF_NAME_RECEIVE_BIKE[] PROGMEM = "rx bike";
+const char PROF_NAME_PARSE[] PROGMEM = "parse";
+const char PROF_NAME_RIDE_UPDATE[] PROGMEM = "ride";
+const char PROF_NAME_BLE_UPDATE[] PROGMEM = "ble";
+const char PROF_NAME_COMMAND[] PROGMEM = "command";
+const char PROF_NAME_LOGGING[] PROGMEM = "logging";
+const char* const PROF_PHASE_NAMES[PROF_NUM_PHASES] PROGMEM = {
+    PROF_NAME_RECEIVE_HU, PROF_NAME_RECEIVE_BIKE, PROF_NAME_PARSE,
+    PROF_NAME_RIDE_UPDATE, PROF_NAME_BLE_UPDATE, PROF_NAME_COMMAND,
+    PROF_NAME_LOGGING};
+
+struct PhaseStats {
+    uint32_t count;
+    uint32_t total_micros;
+    uint16_t min_micros;
+    uint16_t max_micros;    // saturates at 65535
+    uint16_t buckets[PROF_NUM_BUCKETS];
+};
+
+class PhaseProfiler {
+    public:
+    PhaseStats phases[PROF_NUM_PHASES];
+    unsigned long since;
+
+    void reset() {
+        memset(phases, 0, sizeof(phases));
+        for (uint8_t i = 0; i < PROF_NUM_PHASES; phases[i++].min_micros = 0xFFFF);
+        since = millis();
+    }
+    void record(const uint8_t phase, const unsigned long elapsed) {
+        PhaseStats& stats = phases[phase];
+        const uint16_t clamped = elapsed > 0xFFFF ? 0xFFFF : elapsed;
+        stats.count++;
+        stats.total_micros += elapsed;
+        if (clamped < stats.min_micros) stats.min_micros = clamped;
+        if (clamped > stats.max_micros) stats.max_micros = clamped;
+        uint8_t bucket = 0;
+        for (uint16_t rest = clamped >> PROF_FIRST_BUCKET_LOG2;
+             rest && bucket < PROF_NUM_BUCKETS - 1; rest >>= 1)
+            bucket++;
+        if (stats.buckets[bucket] < 0xFFFF) stats.buckets[bucket]++;
+    }
+    void dump(Logger& logger) const {
+        char buf[64];
+        char name[8];
+        snprintf_P(buf, 64, PSTR("Profile over %lus (us)\n"
+                                 "phase      count    mean   min   max\n"),
+                   (millis() - since) / 1000);
+        logger.print(buf);
+        for (uint8_t i = 0; i < PROF_NUM_PHASES; i++) {
+            const PhaseStats& stats = phases[i];
+            strncpy_P(name, (const char*) pgm_read_ptr(&PROF_PHASE_NAMES[i]), 8);
+            name[7] = '\0';
+            snprintf_P(buf, 64, PSTR("%-7s %8lu %7lu %5u %5u\n"), name,
+                       (unsigned long) stats.count,
+                       stats.count ? stats.total_micros / stats.count : 0UL,
+                       stats.count ? stats.min_micros : 0, stats.max_micros);
+            logger.print(buf);
+            // Histogram: counts per bucket from <16us up to >=16ms
+            uint8_t len = snprintf_P(buf, 64, PSTR("\t"));
+            for (uint8_t b = 0; b < PROF_NUM_BUCKETS; b++) {
+                len += snprintf_P(buf + len, 64 - len, PSTR("%u "), stats.buckets[b]);
+                if (b == PROF_NUM_BUCKETS / 2 - 1 || b == PROF_NUM_BUCKETS - 1) {
+                    buf[len - 1] = '\n';
+                    logger.print(buf);
+                    len = snprintf_P(buf, 64, PSTR("\t"));
+                }
+            }
+        }
+    }
+};
+
+PhaseProfiler profiler;
+
+#define PROF_RECORD(phase, elapsed) profiler.record(phase, elapsed)
+// Time a statement; the variadic form lets it contain commas
+#define PROFILE(phase, ...) do { \
+        const unsigned long _prof_start = micros(); \
+        __VA_ARGS__; \
+        profiler.record(phase, micros() - _prof_start); \
+    } while (0)
+#else
+#define PROF_RECORD(phase, elapsed)
+#define PROFILE(phase, ...) do { __VA_ARGS__; } while (0)
+#endif
+
+#endif
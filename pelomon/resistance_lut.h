@@ -7,18 +7,43 @@
  * Licensed under the CC-BY-NC 4.0 license
  * (https://creativecommons.org/licenses/by-nc/4.0/).
  */
+#include <avr/eeprom.h>
 #include "eeprom_map.h"
 
 #ifndef RESISTANCE_LUT_H
 #define RESISTANCE_LUT_H
-#define TABLE_SPACING (100.0f / 30.0f)
+/* Translation is done in 4.12 fixed point. Each of the 30 segments
+ * spans 100/30 units of resistance, so segment lb starts at
+ * lb * 4096 * 100 / 30 = lb * 13653.3; rounding the constant up keeps
+ * exact multiples of 10 from truncating to the integer below.
+ */
+#define LUT_FRAC_BITS 12
+#define LUT_SEGMENT_Q12 13654UL
+#define LUT_SLOPE_NUMERATOR 13653UL
 class ResistanceLUT
 {
   private:
     Logger& logger;
     uint16_t lut[31];
+    // Resistance per raw unit within each segment, 4.12 fixed point
+    uint16_t slope[30];
     bool valid_;
     bool synced;
+    bool checked;   // valid_ reflects the current contents of lut[]
+    bool ready;     // slope[] is built for the current, valid lut[]
+    // Next byte of the table and checksum for sync_step() to write
+    uint8_t sync_pos;
+    uint16_t sync_checksum;
+
+    void build_translation() {
+        ready = false;
+        if (!is_valid()) return;
+        for (uint8_t i = 0; i < 30; i++) {
+            const uint16_t span = lut[i + 1] - lut[i];
+            slope[i] = (LUT_SLOPE_NUMERATOR + span / 2) / span;
+        }
+        ready = true;
+    }
     
     uint16_t compute_checksum() {
         uint16_t checksum = 0;
@@ -31,10 +56,6 @@ class ResistanceLUT
         return (EEPROM.read(address + 1) << 8) | EEPROM.read(address);
     }
 
-    void update_uint16t(int address, uint16_t value) {
-        EEPROM.update(address, value & 0xFF);
-        EEPROM.update(address + 1, (value >> 8) & 0xFF);
-    }
   
   public:
       ResistanceLUT(Logger& logger_): logger(logger_) {};
@@ -54,15 +75,20 @@ class ResistanceLUT
               for (uint8_t i = 0; i < 31; lut[i++] = 0xFFFF);
           }
           synced = true;
+          sync_pos = 0;
+          // Also rescan for monotonicity before building the translation
+          checked = false;
+          build_translation();
       }
       bool is_valid() {
-          if (!synced) {
+          if (!checked) {
               valid_ = true;
               for (uint8_t i = 0; i < 31; i++) {
                   if (lut[i] == 0xFFFF) valid_ = false;
                   // Ensure monotonicity
                   if (i > 0 && lut[i] <= lut[i-1]) valid_ = false;
               }
+              checked = true;
           }
           return valid_;
       }
@@ -70,54 +96,70 @@ class ResistanceLUT
         if (index > 30) {
             return false;
         }
+        // The bike resends the same table on every boot; a table loaded
+        // from EEPROM keeps translating until an entry actually changes
+        if (ready && lut[index] == raw_value) return true;
         lut[index] = raw_value;
         synced = false;
-        valid_ = valid_ && raw_value != 0xFFFF;
+        // Any sync in progress starts over with the new table
+        sync_pos = 0;
+        checked = false;
+        // Stop translating until the new table is synced and rebuilt
+        ready = false;
+        return true;
       }
-      void sync_to_eeprom() {
-          if (!is_valid()) return;
-          uint8_t address = EEPROM_RESISTANCE_LUT_BASE_ADDRESS;
-          for (uint8_t i = 0; i < 31; i++) {
-              update_uint16t(address, lut[i]);
-              address += 2;
-          }
-          update_uint16t(EEPROM_RESISTANCE_LUT_CHECKSUM_ADDRESS,
-                         compute_checksum());
+      bool sync_step() {
+          // Writes at most one byte of the table and its checksum, only
+          // once the last has finished; returns whether more remain
+          if (synced || !is_valid()) return false;
+          if (!eeprom_is_ready()) return true;
+          if (sync_pos == 0) sync_checksum = compute_checksum();
+          // The checksum follows lut[] in EEPROM, and goes last so that a
+          // table torn by a reset fails it
+          const uint16_t value = sync_pos < 62 ? lut[sync_pos >> 1] : sync_checksum;
+          EEPROM.update(EEPROM_RESISTANCE_LUT_BASE_ADDRESS + sync_pos,
+                        sync_pos & 1 ? value >> 8 : value & 0xFF);
+          if (++sync_pos < 64) return true;
+          sync_pos = 0;
           synced = true;
+          build_translation();
+          return false;
       }
-      uint8_t translate_raw_resistance(const uint16_t raw_resistance) {
+      uint8_t translate_raw_resistance(const uint16_t raw_resistance) const {
           // Invalid LUT
-          if (!is_valid()) return 0xFF;
+          if (!ready) return 0xFF;
           // Out of range 
           if (raw_resistance < lut[0] || raw_resistance > lut[30]) return 0xFF;
 
-          // Linear search to find bounding interval
-          uint8_t lb;
-          for (lb = 0; lb < 29; lb++) {
-              if (raw_resistance >= lut[lb] && raw_resistance <= lut[lb+1])
-                  break;
+          // Binary search for the segment with lut[lb] <= raw < lut[lb+1];
+          // raw == lut[30] lands at the end of the last segment.
+          uint8_t lb = 0, ub = 30;
+          while (ub - lb > 1) {
+              const uint8_t mid = (lb + ub) >> 1;
+              if (raw_resistance < lut[mid]) ub = mid;
+              else lb = mid;
           }
           // The 31 samples correspond to values @ 0, 3.3, 6.7, 10, ...
-          float proportion = ((raw_resistance - lut[lb]) /
-                              ((float) (lut[lb + 1] - lut[lb])));
-          return (uint8_t) (TABLE_SPACING * (proportion + lb));
+          const uint32_t resistance_q12 =
+              lb * LUT_SEGMENT_Q12 +
+              (uint32_t) (raw_resistance - lut[lb]) * slope[lb];
+          return (uint8_t) (resistance_q12 >> LUT_FRAC_BITS);
       }
       void serial_status_text() const {
           char buf[48];
-          snprintf_P(buf, 48,
-                     PSTR("\tResistanceLUT\n"
-                          "\t\tvalid: %d synced: %d\n"
-                          "\t\tLUT:\n"),
-                     (int)valid_, (int)synced);
-          logger.print(buf);
-          for (uint8_t base=0; base<28; base += 4) {
-              snprintf_P(buf, 32, PSTR("\t\t% 5d % 5d % 5d % 5d\n"),
-                       lut[base+0], lut[base+1], lut[base+2], lut[base+3]);
-              logger.print(buf);
+          Formatter f(buf, 48);
+          f.str_P(PSTR("\tResistanceLUT\n\t\tvalid: ")).dec(valid_)
+           .str_P(PSTR(" synced: ")).dec(synced).str_P(PSTR("\n\t\tLUT:\n"));
+          logger.print(f.c_str());
+          // Four entries a line
+          for (uint8_t base=0; base<31; base += 4) {
+              f.reset().str_P(PSTR("\t\t"));
+              for (uint8_t i = base; i < base + 4 && i < 31; i++) {
+                  if (i > base) f.chr(' ');
+                  f.dec(lut[i], 5);
+              }
+              logger.print(f.chr('\n').c_str());
           }
-          snprintf_P(buf, 32, PSTR("\t\t% 5d % 5d % 5d\n"),
-                   lut[28], lut[29], lut[30]);
-          logger.print(buf);
       }
 };
 #endif
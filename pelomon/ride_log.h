@@ -0,0 +1,168 @@
+/* Wear-leveled EEPROM log of the ride totals.
+ *
+ * Every save appends a record to the next slot of a ring in the EEPROM
+ * left over after the settings, so no byte is rewritten more often than
+ * once per lap of the ring. Each record carries a sequence number and a
+ * CRC; at boot the valid record with the newest sequence number wins, and
+ * one torn by a reset mid-write simply fails its CRC.
+ *
+ * Saves are coalesced (see RIDE_LOG_INTERVAL_MILLIS) and written one byte
+ * per call to write_step(), only when the previous byte has finished, so
+ * the 3.3ms EEPROM write time is never spent waiting.
+ *
+ * Record layout (little-endian):
+ *      [sequence: 2] [energy kJ: 4] [crank revs: 4] [wheel revs: 4] [CRC: 2]
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _RIDE_LOG_H_
+#define _RIDE_LOG_H_
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+#include "eeprom_map.h"
+
+struct RideLogRecord {
+    uint16_t sequence;
+    RideTotals totals;
+    uint16_t crc;
+};
+
+// 16 bytes on the AVR, which doesn't pad
+#define RIDE_LOG_RECORD_LEN sizeof(RideLogRecord)
+#define RIDE_LOG_SLOTS ((EEPROM_RIDE_LOG_END_ADDRESS - EEPROM_RIDE_LOG_BASE_ADDRESS) / \
+                        RIDE_LOG_RECORD_LEN)
+#define RIDE_LOG_NO_SLOT 0xFF
+
+class RideLog {
+    public:
+    // Slot of the newest valid record, or RIDE_LOG_NO_SLOT
+    uint8_t newest_slot;
+    uint16_t sequence;
+    RideTotals saved;           // what the newest record holds
+    // Record being written; pos counts bytes written so far
+    RideLogRecord pending;
+    uint8_t pending_slot;
+    uint8_t pos;
+    bool writing;
+    // Write budget
+    uint8_t tokens;
+    unsigned long last_refill_ms;
+    unsigned long last_save_ms;
+    uint16_t records_written;   // since boot
+
+    static uint16_t address(const uint8_t slot) {
+        return EEPROM_RIDE_LOG_BASE_ADDRESS + (uint16_t) slot * RIDE_LOG_RECORD_LEN;
+    }
+    static uint16_t record_crc(const RideLogRecord& record) {
+        const uint8_t* bytes = (const uint8_t*) &record;
+        uint16_t crc = 0xFFFF;
+        for (uint8_t i = 0; i < offsetof(RideLogRecord, crc); i++)
+            crc = _crc16_update(crc, bytes[i]);
+        return crc;
+    }
+    static bool read_record(const uint8_t slot, RideLogRecord& record) {
+        uint8_t* bytes = (uint8_t*) &record;
+        const uint16_t base = address(slot);
+        for (uint8_t i = 0; i < sizeof(record); i++) bytes[i] = EEPROM.read(base + i);
+        return record.crc == record_crc(record);
+    }
+
+    bool initialize() {
+        // Returns whether any totals were found
+        newest_slot = RIDE_LOG_NO_SLOT;
+        sequence = 0;
+        memset(&saved, 0, sizeof(saved));
+        writing = false;
+        tokens = RIDE_LOG_WRITE_BURST;
+        last_refill_ms = last_save_ms = millis();
+        records_written = 0;
+        RideLogRecord record;
+        for (uint8_t slot = 0; slot < RIDE_LOG_SLOTS; slot++) {
+            if (!read_record(slot, record)) continue;
+            // The ring only ever holds its last lap of sequence numbers,
+            // so "newer" is well defined across the 16 bit rollover
+            if (newest_slot == RIDE_LOG_NO_SLOT || (int16_t) (record.sequence - sequence) > 0) {
+                newest_slot = slot;
+                sequence = record.sequence;
+                saved = record.totals;
+            }
+        }
+        return newest_slot != RIDE_LOG_NO_SLOT;
+    }
+    void refill(const unsigned long now) {
+        if (tokens >= RIDE_LOG_WRITE_BURST) {
+            last_refill_ms = now;
+            return;
+        }
+        while (tokens < RIDE_LOG_WRITE_BURST && now - last_refill_ms >= RIDE_LOG_INTERVAL_MILLIS) {
+            tokens++;
+            last_refill_ms += RIDE_LOG_INTERVAL_MILLIS;
+        }
+    }
+    bool save(const RideTotals& totals, const bool ride_active, const unsigned long now) {
+        // Starts a write if one is due and the budget allows; returns
+        // whether write_step() has work to do
+        refill(now);
+        if (writing) return true;
+        if (tokens == 0 || memcmp(&totals, &saved, sizeof(saved)) == 0) return false;
+        // While riding, save once per interval; flush as soon as it stops
+        if (ride_active && now - last_save_ms < RIDE_LOG_INTERVAL_MILLIS) return false;
+        tokens--;
+        last_save_ms = now;
+        memset(&pending, 0, sizeof(pending));
+        pending.sequence = sequence + 1;
+        pending.totals = totals;
+        pending.crc = record_crc(pending);
+        pending_slot = newest_slot == RIDE_LOG_NO_SLOT || newest_slot + 1 == RIDE_LOG_SLOTS ?
+                       0 : newest_slot + 1;
+        pos = 0;
+        writing = true;
+        return true;
+    }
+    bool write_step() {
+        // Writes at most one byte; returns whether more remain
+        if (!writing) return false;
+        if (!eeprom_is_ready()) return true;
+        const uint8_t* bytes = (const uint8_t*) &pending;
+        EEPROM.update(address(pending_slot) + pos, bytes[pos]);
+        if (++pos < sizeof(pending)) return true;
+        // The CRC went last, so the record only now counts
+        writing = false;
+        newest_slot = pending_slot;
+        sequence = pending.sequence;
+        saved = pending.totals;
+        records_written++;
+        return false;
+    }
+    void erase() {
+        // Invalidate every record; changing any one byte breaks its CRC.
+        // Blocks for one EEPROM write per valid record.
+        RideLogRecord record;
+        for (uint8_t slot = 0; slot < RIDE_LOG_SLOTS; slot++) {
+            if (!read_record(slot, record)) continue;
+            EEPROM.write(address(slot), ~EEPROM.read(address(slot)));
+        }
+        writing = false;
+        newest_slot = RIDE_LOG_NO_SLOT;
+        memset(&saved, 0, sizeof(saved));
+    }
+    void serial_status_text(Logger& logger) const {
+        char buf[64];
+        snprintf_P(buf, 64, PSTR("\t\tRide log: slot %u seq %u, %u saved\n"),
+                   newest_slot, sequence, records_written);
+        logger.print(buf);
+        snprintf_P(buf, 64, PSTR("\t\t%lu kJ %lu crank %lu wheel\n"),
+                   saved.energy_kj, saved.crank_revs, saved.wheel_revs);
+        logger.print(buf);
+    }
+};
+
+RideLog ride_log;
+
+#endif
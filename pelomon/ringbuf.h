@@ -1,4 +1,15 @@
-/* Debug message ring buffer.
+/* Wire-trace capture ring and replay source.
+ *
+ * Every complete frame seen on either line is recorded, bytes and all,
+ * into a packed ring in SRAM. The ring can be dumped as a raw binary
+ * blob in the same format as peloton_decoding/resistance-stepped-10s.bin,
+ * or played back through PelotonProxy at its original timing to
+ * reproduce a glitch seen in the field.
+ *
+ * Record layout:
+ *      [flags | frame length] [delta ms: 1 byte, or 2 if CAPTURE_LONG_DELTA]
+ *      [frame bytes]
+ * where the delta is from the previous record.
  *
  * Part of the PeloMon project. See the accompanying blog post at
  * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
@@ -11,44 +22,154 @@
 #define __RINGBUF_H__
 
 #ifdef ENABLE_RINGBUF
-const uint8_t MSG_RINGBUF_LEN = 32;
-uint8_t last_hu_msgs[MSG_RINGBUF_LEN];
-uint32_t last_bike_msgs[MSG_RINGBUF_LEN];
-unsigned long last_msg_times[MSG_RINGBUF_LEN];
-uint8_t msg_index;
-
-void dump_ringbuf(void) {
-    char logbuf[32];
-    for (uint8_t j=0; j < MSG_RINGBUF_LEN; j++) {
-        uint8_t i = (msg_index + j) % MSG_RINGBUF_LEN;
-        snprintf_P(logbuf, 32, PSTR("%lu: %hhx - %lx\n"),
-                   last_msg_times[i], last_hu_msgs[i], last_bike_msgs[i]);
-        logger.print(logbuf);
-    }
-}
-
-void add_ringbuf(void) {
-    last_msg_times[msg_index] = millis();
-    last_hu_msgs[msg_index] = hu_buf[1];
-    last_bike_msgs[msg_index] = bike_buf[3];
-    last_bike_msgs[msg_index] <<= 8;
-    last_bike_msgs[msg_index] |= bike_buf[4];
-    last_bike_msgs[msg_index] <<= 8;
-    last_bike_msgs[msg_index] |= bike_buf[5];
-    last_bike_msgs[msg_index] <<= 8;
-    last_bike_msgs[msg_index] |= bike_buf[6];
-    msg_index = (msg_index + 1) % MSG_RINGBUF_LEN;
-}
-
-void init_ringbuf(void) {
-    memset(last_hu_msgs, 0, MSG_RINGBUF_LEN);
-    memset(last_bike_msgs, 0, 4*MSG_RINGBUF_LEN);
-    memset(last_msg_times, 0, 4*MSG_RINGBUF_LEN);
-    msg_index = 0;
-}
+// uint8_t indices wrap at exactly the ring length
+#define CAPTURE_RING_LEN 256
+#define CAPTURE_LEN_MASK 0x0F
+#define CAPTURE_FROM_BIKE 0x10
+#define CAPTURE_LONG_DELTA 0x20
+
+class CaptureRing {
+    public:
+    uint8_t ring[CAPTURE_RING_LEN];
+    uint8_t head, tail;     // head == tail is empty
+    uint16_t last_timestamp;
+    bool enabled;
+
+    void initialize() {
+        head = tail = 0;
+        last_timestamp = 0;
+        enabled = true;
+    }
+    bool empty() const {
+        return head == tail;
+    }
+    uint8_t record_size(const uint8_t pos) const {
+        const uint8_t flags = ring[pos];
+        return 2 + ((flags & CAPTURE_LONG_DELTA) ? 1 : 0) + (flags & CAPTURE_LEN_MASK);
+    }
+    uint16_t record_delta(const uint8_t pos) const {
+        const uint8_t lo = ring[(uint8_t) (pos + 1)];
+        if (!(ring[pos] & CAPTURE_LONG_DELTA)) return lo;
+        return lo | ((uint16_t) ring[(uint8_t) (pos + 2)] << 8);
+    }
+    uint8_t record_frame(const uint8_t pos) const {
+        // Index of the first frame byte
+        return pos + ((ring[pos] & CAPTURE_LONG_DELTA) ? 3 : 2);
+    }
+    void record(const FrameDecoder& frame, const uint16_t timestamp) {
+        if (!enabled || frame.len == 0) return;
+        const uint16_t delta = timestamp - last_timestamp;
+        last_timestamp = timestamp;
+        uint8_t flags = frame.len & CAPTURE_LEN_MASK;
+        if (frame.header() == 0xF1) flags |= CAPTURE_FROM_BIKE;
+        if (delta > 0xFF) flags |= CAPTURE_LONG_DELTA;
+        const uint8_t needed = 2 + ((flags & CAPTURE_LONG_DELTA) ? 1 : 0) + frame.len;
+        // Make room by dropping the oldest records
+        while ((uint8_t) (CAPTURE_RING_LEN - 1 - (uint8_t) (head - tail)) < needed)
+            tail += record_size(tail);
+        ring[head++] = flags;
+        ring[head++] = delta & 0xFF;
+        if (flags & CAPTURE_LONG_DELTA) ring[head++] = delta >> 8;
+        for (uint8_t i = 0; i < frame.len; ring[head++] = frame.buf[i++]);
+    }
+    void dump(Logger& logger) const {
+        // Frames only, back to back, oldest first
+        uint8_t buf[BIKE_MSG_BUF_LEN];
+        for (uint8_t pos = tail; pos != head; pos += record_size(pos)) {
+            const uint8_t len = ring[pos] & CAPTURE_LEN_MASK;
+            const uint8_t start = record_frame(pos);
+            for (uint8_t i = 0; i < len; i++) buf[i] = ring[(uint8_t) (start + i)];
+            logger.write(buf, len);
+        }
+    }
+};
+
+CaptureRing peloton_capture;
+
+/* One line of a replayed trace, with the same interface as the hardware
+ * receiver channels. Bytes are read straight out of the capture ring.
+ */
+class ReplaySerial {
+    public:
+    const CaptureRing* capture;
+    uint8_t pos;
+    uint8_t remaining;
+    uint16_t pushed_at;
+
+    void begin(const CaptureRing* capture_) {
+        capture = capture_;
+        remaining = 0;
+        pushed_at = 0;
+    }
+    void listen() {
+        return;
+    }
+    int8_t available() const {
+        return remaining;
+    }
+    uint8_t read() {
+        if (!remaining) return 0xFF;
+        remaining--;
+        return capture->ring[pos++];
+    }
+    uint16_t timestamp() const {
+        return pushed_at;
+    }
+    void push(const uint8_t start, const uint8_t len, const uint16_t ts) {
+        pos = start;
+        remaining = len;
+        pushed_at = ts;
+    }
+};
+
+/* Plays the capture ring back in a loop. Each frame is stamped with the
+ * time it was due rather than when it was read, just as the hardware
+ * receiver stamps bytes on arrival.
+ */
+class TraceReplay {
+    public:
+    ReplaySerial hu, bike;
+    uint8_t next;
+    unsigned long next_due;
+
+    void begin(CaptureRing& capture) {
+        // Recording the replay would overwrite the trace being played
+        capture.enabled = false;
+        hu.begin(&capture);
+        bike.begin(&capture);
+        next = capture.tail;
+        next_due = millis();
+    }
+    void end(CaptureRing& capture) {
+        hu.remaining = bike.remaining = 0;
+        capture.enabled = true;
+    }
+    inline void poll() {
+        const CaptureRing& capture = *hu.capture;
+        if (capture.empty() || (long) (millis() - next_due) < 0) return;
+        const bool from_bike = capture.ring[next] & CAPTURE_FROM_BIKE;
+        ReplaySerial& line = from_bike ? bike : hu;
+        // Wait for the previous frame on this line to be read
+        if (line.available()) return;
+        line.push(capture.record_frame(next), capture.ring[next] & CAPTURE_LEN_MASK,
+                  rx_ticks_from_millis(next_due));
+        next += capture.record_size(next);
+        if (next == capture.head) {
+            // Start over, with the trace's first frame right away
+            next = capture.tail;
+        } else {
+            next_due += capture.record_delta(next);
+        }
+    }
+};
 
+// Frames are timed in receive ticks; the ring keeps milliseconds
+#define capture_frame(frame, timestamp) \
+    peloton_capture.record(frame, rx_ticks_to_millis(timestamp))
+#define init_ringbuf() peloton_capture.initialize()
+#define dump_ringbuf() peloton_capture.dump(logger)
 #else
-#define add_ringbuf()
+#define capture_frame(frame, timestamp)
 #define init_ringbuf()
 #define dump_ringbuf()
 #endif
@@ -0,0 +1,166 @@
+/* Cooperative scheduler for the main loop.
+ *
+ * Each task has a period (every pass, on signal, or every so many ms),
+ * a worst-case budget and a deadline. A task with a budget only runs if
+ * it fits before the next HU request is expected, predicted from the
+ * spacing of recent requests, and never while a bike reply is due; once
+ * it has waited out its deadline it runs regardless. Tasks without a
+ * budget are never deferred, so receive and decode keep up with the bike.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#define SCHED_MAX_TASKS 8
+#define SCHED_EVERY_PASS 0
+#define SCHED_ON_SIGNAL 0xFFFF
+// Slack left before the predicted HU request
+#define SCHED_GUARD_MICROS 2000
+// Longer gaps between HU requests are pauses, not the polling interval
+#define SCHED_HU_INTERVAL_MAX_MICROS 1000000UL
+#define SCHED_NO_WINDOW 0
+#define SCHED_OPEN_WINDOW 0x7FFFFFFFL
+
+struct TaskSpec {
+    void (*run)(void);
+    uint16_t period_millis;     // SCHED_EVERY_PASS, SCHED_ON_SIGNAL or a period
+    uint16_t deadline_millis;   // runs without a window once this late
+    uint16_t budget_micros;     // worst case; 0 is never deferred
+    const char* name;
+};
+
+struct TaskState {
+    unsigned long due_since;    // millis() when it last became due
+    bool pending;
+    // Saturating counters for the sched command
+    uint16_t runs;
+    uint16_t deferrals;
+    uint16_t late;              // ran past its deadline without a window
+    uint16_t overruns;          // took longer than its budget
+};
+
+inline void saturating_increment(uint16_t& counter) {
+    if (counter < 0xFFFF) counter++;
+}
+inline void saturating_increment_by(uint16_t& counter, const uint16_t by) {
+    counter = (counter > 0xFFFF - by) ? 0xFFFF : counter + by;
+}
+
+class Scheduler {
+    public:
+    const TaskSpec* tasks;      // in PROGMEM
+    uint8_t num_tasks;
+    TaskState state[SCHED_MAX_TASKS];
+
+    // HU polling model
+    unsigned long last_hu_micros;
+    unsigned long hu_interval_micros;   // 0 until two requests were seen
+    bool hu_seen;
+    bool awaiting_reply;
+
+    void initialize(const TaskSpec* tasks_, const uint8_t num_tasks_) {
+        tasks = tasks_;
+        num_tasks = num_tasks_ > SCHED_MAX_TASKS ? SCHED_MAX_TASKS : num_tasks_;
+        memset(state, 0, sizeof(state));
+        hu_interval_micros = 0;
+        hu_seen = awaiting_reply = false;
+    }
+    void signal(const uint8_t task) {
+        if (state[task].pending) return;
+        state[task].pending = true;
+        state[task].due_since = millis();
+    }
+    void note_hu_request(const unsigned long at_micros) {
+        if (hu_seen) {
+            const unsigned long interval = at_micros - last_hu_micros;
+            if (interval < SCHED_HU_INTERVAL_MAX_MICROS) {
+                // Follow a shorter interval at once, a longer one slowly,
+                // so the prediction errs early
+                if (hu_interval_micros == 0 || interval < hu_interval_micros)
+                    hu_interval_micros = interval;
+                else
+                    hu_interval_micros += (interval - hu_interval_micros) >> 3;
+            }
+        }
+        last_hu_micros = at_micros;
+        hu_seen = true;
+        awaiting_reply = true;
+    }
+    void note_reply_done() {
+        awaiting_reply = false;
+    }
+    long window_micros() const {
+        // Time that can be spent before the next HU request is expected
+        if (awaiting_reply) return SCHED_NO_WINDOW;
+        if (hu_interval_micros == 0) return SCHED_OPEN_WINDOW;
+        const long until = (long) (last_hu_micros + hu_interval_micros - micros());
+        // Missed by more than an interval: the HU has stopped polling
+        if (until < -(long) hu_interval_micros) return SCHED_OPEN_WINDOW;
+        if (until < SCHED_GUARD_MICROS) return SCHED_NO_WINDOW;
+        return until - SCHED_GUARD_MICROS;
+    }
+    void run_pass() {
+        for (uint8_t i = 0; i < num_tasks; i++) {
+            TaskSpec spec;
+            memcpy_P(&spec, tasks + i, sizeof(spec));
+            TaskState& task = state[i];
+            const unsigned long now = millis();
+            if (!task.pending) {
+                if (spec.period_millis == SCHED_EVERY_PASS ||
+                    (spec.period_millis != SCHED_ON_SIGNAL &&
+                     now - task.due_since >= spec.period_millis)) {
+                    task.pending = true;
+                    task.due_since = now;
+                }
+            }
+            if (!task.pending) continue;
+            if (spec.budget_micros && window_micros() < (long) spec.budget_micros) {
+                if (now - task.due_since < spec.deadline_millis) {
+                    saturating_increment(task.deferrals);
+                    continue;
+                }
+                saturating_increment(task.late);
+            }
+            task.pending = false;
+            const unsigned long start = micros();
+            spec.run();
+            if (spec.budget_micros && micros() - start > spec.budget_micros)
+                saturating_increment(task.overruns);
+            saturating_increment(task.runs);
+        }
+    }
+    uint16_t total_overruns() const {
+        // Tasks that ran over their budget or past their deadline
+        uint16_t total = 0;
+        for (uint8_t i = 0; i < num_tasks; i++) {
+            saturating_increment_by(total, state[i].overruns);
+            saturating_increment_by(total, state[i].late);
+        }
+        return total;
+    }
+    void dump(Logger& logger) const {
+        char buf[48];
+        char name[8];
+        snprintf_P(buf, 48, PSTR("HU every %luus\n"), hu_interval_micros);
+        logger.print(buf);
+        logger.print(F("task       runs defer  late  over\n"));
+        for (uint8_t i = 0; i < num_tasks; i++) {
+            const TaskState& task = state[i];
+            strncpy_P(name, (const char*) pgm_read_ptr(&tasks[i].name), 8);
+            name[7] = '\0';
+            snprintf_P(buf, 48, PSTR("%-7s %7u %5u %5u %5u\n"), name,
+                       task.runs, task.deferrals, task.late, task.overruns);
+            logger.print(buf);
+        }
+    }
+};
+
+Scheduler scheduler;
+
+#endif
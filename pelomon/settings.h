@@ -9,12 +9,76 @@
  */
 #define SIMULATOR_MESSAGE_INTERVAL_MILLIS 100
 
-#define BT_UPDATE_INTERVAL_MILLIS 500
+// Record raw Peloton frames for the ring and replay commands
+#define ENABLE_RINGBUF
+// Time each phase of the main loop for the prof command
+#define ENABLE_PROFILER
+
+// BLE measurements are notified as soon as they change, but no more
+// often than the minimum interval per characteristic. While riding an
+// unchanged value is re-sent at the heartbeat interval; once idle
+// nothing is sent until something changes.
+#define BT_MIN_NOTIFY_INTERVAL_MILLIS 250
+#define BT_HEARTBEAT_INTERVAL_MILLIS 2000
+// Power and cadence are notified as the time-weighted average of this
+// many readings (1, 2, 4 or 8); 1 sends each reading as it is
+#define OUTPUT_FILTER_WINDOW 2
+// No new power or cadence for this long means the ride has stopped
+#define RIDE_IDLE_TIMEOUT_MILLIS 5000
+// A gap this long between power readings, or a reboot, starts a new
+// workout for the FTMS energy figure; the CP/CSC totals carry on
+#define WORKOUT_GAP_MILLIS IDLE_AFTER_MILLIS
+// Ride totals are saved to EEPROM at most once per interval while riding,
+// and as soon as the ride stops. At most the burst can be written back to
+// back; on average no more than one record per interval, so each of the
+// log's 56 slots sees about one write an hour.
+#define RIDE_LOG_INTERVAL_MILLIS 60000UL
+#define RIDE_LOG_WRITE_BURST 4
+
+// Longest gap allowed between the HU request and each byte of the bike's
+// reply. Once enough replies have been timed, the gap allowed is a high
+// percentile of measured latency plus a margin, kept within these bounds.
+#define BIKE_RESPONSE_TIMEOUT_MILLIS 11
+#define BIKE_TIMEOUT_MIN_MICROS 1000
+#define BIKE_TIMEOUT_MARGIN_MICROS 1000
+#define BIKE_TIMEOUT_PERCENTILE 99
+
+// The BLE module only reports UART data when asked, so ask this often
+// for commands instead of on every loop
+#define BLE_UART_POLL_INTERVAL_MILLIS 100
+
+// Which BLE services to offer. All of them keeps CP/CSC clients such as
+// older watches working, at three AT round trips per update; with only
+// Fitness Machine (FTMS) it is one. The svc command overrides this in
+// EEPROM, e.g. "svc ftms" when every client speaks FTMS.
+#define BLE_SERVICES_FTMS_ONLY 1
+#define BLE_SERVICES_ALL 2
+#define BLE_SERVICES_DEFAULT BLE_SERVICES_ALL
+
+// With no Peloton traffic for this long (and no ride in progress), drop
+// the BLE radio to slow intervals and sleep the MCU between interrupts.
+// Intervals are AT+GAPINTERVALS arguments: min and max connection
+// interval, advertising interval (ms), advertising timeout (s).
+#define IDLE_AFTER_MILLIS 60000UL
+#define BLE_GAP_INTERVALS_ACTIVE "20,100,100,30"
+#define BLE_GAP_INTERVALS_IDLE "500,1000,1000,30"
+#define BLE_UART_IDLE_POLL_INTERVAL_MILLIS 1000
+
+// With USB attached, how long setup() waits for a serial monitor
+#define SERIAL_CONNECT_TIMEOUT_MILLIS 3000
+
+// Time per loop() spent sending queued log output
+#define LOG_DRAIN_BUDGET_MICROS 1000
 
 #define LOG_LEVEL_NONE  0
 #define LOG_LEVEL_INFO  1
 #define LOG_LEVEL_DEBUG 2
 #define LOG_LEVEL_MAX   255
+// Most verbose level built into the firmware. Log sites above it are
+// compiled out entirely; set to LOG_LEVEL_DEBUG for bench builds.
+#ifndef LOG_LEVEL_COMPILED
+#define LOG_LEVEL_COMPILED LOG_LEVEL_INFO
+#endif
 
 /*
  *  Pin usage and available pins
@@ -47,8 +111,22 @@
 #define PIN_STATE_LISTEN_HU       A3
 #define PIN_STATE_LISTEN_BIKE     A4
 #define PIN_STATE_HANDLE_CMD      A5
+// Port bits behind the state pins, for direct writes: A0-A5 are
+// PF7, PF6, PF5, PF4, PF1, PF0 on the 32u4
+#define PIN_STATE_READ_HU_PORT      PORTF
+#define PIN_STATE_READ_HU_BIT       7
+#define PIN_STATE_READ_BIKE_PORT    PORTF
+#define PIN_STATE_READ_BIKE_BIT     6
+#define PIN_STATE_PROC_MSG_PORT     PORTF
+#define PIN_STATE_PROC_MSG_BIT      5
+#define PIN_STATE_LISTEN_HU_PORT    PORTF
+#define PIN_STATE_LISTEN_HU_BIT     4
+#define PIN_STATE_LISTEN_BIKE_PORT  PORTF
+#define PIN_STATE_LISTEN_BIKE_BIT   1
+#define PIN_STATE_HANDLE_CMD_PORT   PORTF
+#define PIN_STATE_HANDLE_CMD_BIT    0
 // If there is a hardware inverter in the RX chain we do not
-// need to invert the SoftwareSerial sense. If no inverter, then
+// need to invert the serial sense. If no inverter, then
 // we gotta do it in software.
 #define INVERT_PELOTON_SERIAL false
 
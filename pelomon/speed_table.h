@@ -0,0 +1,71 @@
+/* Power to speed lookup table.
+ *
+ * GENERATED by decoding_speed/regress_speed.py --table; do not edit.
+ * Two-piece fit on watts, split at 27.0W:
+ *   low:  0.04660 p^0/2 + -0.14023 p^1/2 + 0.74063 p^2/2 + -0.07605 p^3/2
+ *   high: -1.31158 p^0/2 + 2.23594 p^1/2 + -0.05685 p^2/2 + 0.00087 p^3/2
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _SPEED_TABLE_H_
+#define _SPEED_TABLE_H_
+
+// Samples every 20 dW below 640 dW, then every 160 dW up to 20480 dW
+#define SPEED_TABLE_FINE_STEP_DW 20
+#define SPEED_TABLE_FINE_LIMIT_DW 640
+#define SPEED_TABLE_COARSE_STEP_DW 160
+#define SPEED_TABLE_LIMIT_DW 20480U
+#define SPEED_TABLE_LEN 157
+
+// Speed in hundredths of a mph
+const uint16_t SPEED_TABLE_CMPH[SPEED_TABLE_LEN] PROGMEM = {
+        5,   111,   212,   303,   385,   460,   529,   591,
+      647,   698,   743,   784,   819,   851,   906,   937,
+      968,   997,  1025,  1052,  1078,  1103,  1127,  1151,
+     1174,  1196,  1218,  1239,  1260,  1280,  1300,  1319,
+     1338,  1476,  1596,  1702,  1797,  1884,  1964,  2038,
+     2107,  2172,  2234,  2292,  2347,  2400,  2451,  2500,
+     2547,  2593,  2637,  2680,  2722,  2763,  2802,  2841,
+     2880,  2917,  2954,  2990,  3025,  3060,  3095,  3129,
+     3163,  3197,  3230,  3263,  3296,  3328,  3360,  3392,
+     3424,  3456,  3488,  3519,  3551,  3582,  3614,  3645,
+     3676,  3708,  3739,  3770,  3801,  3833,  3864,  3895,
+     3927,  3958,  3990,  4022,  4053,  4085,  4117,  4149,
+     4181,  4213,  4245,  4278,  4310,  4343,  4376,  4409,
+     4442,  4475,  4509,  4542,  4576,  4610,  4644,  4678,
+     4712,  4746,  4781,  4816,  4851,  4886,  4921,  4957,
+     4992,  5028,  5064,  5101,  5137,  5174,  5210,  5247,
+     5285,  5322,  5360,  5397,  5435,  5473,  5512,  5550,
+     5589,  5628,  5667,  5707,  5746,  5786,  5826,  5866,
+     5907,  5947,  5988,  6029,  6070,  6112,  6153,  6195,
+     6237,  6280,  6322,  6365,  6408,
+};
+
+uint16_t speed_from_deciwatts(const uint16_t power_deciwatts) {
+    // Linear interpolation between the two samples around the power
+    if (power_deciwatts >= SPEED_TABLE_LIMIT_DW)
+        return pgm_read_word(&SPEED_TABLE_CMPH[SPEED_TABLE_LEN - 1]);
+    uint8_t index;
+    uint16_t offset, step;
+    if (power_deciwatts < SPEED_TABLE_FINE_LIMIT_DW) {
+        step = SPEED_TABLE_FINE_STEP_DW;
+        index = power_deciwatts / step;
+        offset = power_deciwatts - index * step;
+    } else {
+        step = SPEED_TABLE_COARSE_STEP_DW;
+        const uint16_t coarse = power_deciwatts - SPEED_TABLE_FINE_LIMIT_DW;
+        index = coarse / step;
+        offset = coarse - index * step;
+        index += SPEED_TABLE_FINE_LIMIT_DW / SPEED_TABLE_FINE_STEP_DW;
+    }
+    const int16_t lo = pgm_read_word(&SPEED_TABLE_CMPH[index]);
+    const int16_t hi = pgm_read_word(&SPEED_TABLE_CMPH[index + 1]);
+    // Slope is bounded by the table, so the product fits in 32 bits
+    return lo + (int16_t) (((int32_t) (hi - lo) * offset + step / 2) / step);
+}
+#endif
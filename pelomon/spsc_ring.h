@@ -0,0 +1,117 @@
+/* Single-producer, single-consumer ring buffer.
+ *
+ * One side only ever pushes and the other only ever pops, so the only
+ * shared state is two one-byte indices: head is written only by the
+ * producer and tail only by the consumer. A one-byte load or store can't
+ * be torn on the AVR, so an ISR can push while loop() pops with no
+ * interrupt locking. The indices run freely and are masked on access, so
+ * all N slots are usable and the count is just head - tail. N must be a
+ * power of two no larger than 128.
+ *
+ * A compiler barrier keeps each element's contents written before the
+ * index that publishes it, and read before the index that frees it.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _SPSC_RING_H_
+#define _SPSC_RING_H_
+#include <stdint.h>
+
+#define SPSC_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+template <typename T, uint8_t N>
+class SpscRing {
+    typedef char size_must_be_a_power_of_two_up_to_128[
+        (N > 0 && N <= 128 && (N & (N - 1)) == 0) ? 1 : -1];
+
+    public:
+    T buf[N];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+
+    void reset() {
+        // Only while neither side can be running, e.g. with interrupts off
+        head = tail = 0;
+    }
+
+    // Safe from either side
+    uint8_t count() const {
+        return (uint8_t) (head - tail);
+    }
+    uint8_t space() const {
+        return N - count();
+    }
+    bool empty() const {
+        return head == tail;
+    }
+    bool full() const {
+        return count() == N;
+    }
+
+    // Producer side
+    bool push(const T& item) {
+        const uint8_t h = head;
+        if ((uint8_t) (h - tail) == N) return false;
+        buf[h & (N - 1)] = item;
+        SPSC_BARRIER();
+        head = h + 1;
+        return true;
+    }
+    uint8_t push_n(const T* items, const uint8_t n) {
+        // As many of items as fit; returns how many
+        const uint8_t h = head;
+        uint8_t room = N - (uint8_t) (h - tail);
+        if (room > n) room = n;
+        for (uint8_t i = 0; i < room; i++) buf[(uint8_t) (h + i) & (N - 1)] = items[i];
+        SPSC_BARRIER();
+        head = h + room;
+        return room;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        const uint8_t t = tail;
+        if (head == t) return false;
+        item = buf[t & (N - 1)];
+        SPSC_BARRIER();
+        tail = t + 1;
+        return true;
+    }
+    uint8_t pop_n(T* items, const uint8_t n) {
+        const uint8_t t = tail;
+        uint8_t ready = (uint8_t) (head - t);
+        if (ready > n) ready = n;
+        for (uint8_t i = 0; i < ready; i++) items[i] = buf[(uint8_t) (t + i) & (N - 1)];
+        SPSC_BARRIER();
+        tail = t + ready;
+        return ready;
+    }
+    bool peek(T& item) const {
+        if (empty()) return false;
+        item = buf[tail & (N - 1)];
+        return true;
+    }
+    uint8_t contiguous(const T*& first) const {
+        // The oldest items that lie in one run, up to the end of buf, for
+        // handing straight to a bulk write; follow with consume()
+        const uint8_t t = tail & (N - 1);
+        const uint8_t ready = count();
+        first = buf + t;
+        return ready < N - t ? ready : N - t;
+    }
+    void consume(const uint8_t n) {
+        SPSC_BARRIER();
+        tail = tail + n;
+    }
+    void clear() {
+        // Drop everything queued so far
+        tail = head;
+    }
+};
+
+#endif
@@ -0,0 +1,134 @@
+/* SRAM accounting: a shared scratch arena and stack high-water marks.
+ *
+ * Formatting and command buffers come from one statically sized arena
+ * instead of the stack. A ScratchBuffer takes space on construction and
+ * gives it back when it goes out of scope, so buffers nest like stack
+ * frames but their worst case is fixed at build time and their peak is
+ * measured. A request that doesn't fit gets whatever is left (at worst a
+ * single byte, enough for an empty string), so output is truncated rather
+ * than memory overrun, and the shortfall is counted.
+ *
+ * On the AVR, everything between the end of static data and the stack is
+ * painted with a canary before main(); the mem command reports how far
+ * the stack has ever reached into it.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _SRAM_H_
+#define _SRAM_H_
+
+// Enough for a command line, a status dump and a nested F() string
+#ifndef SCRATCH_ARENA_LEN
+#define SCRATCH_ARENA_LEN 224
+#endif
+#define STACK_CANARY 0xC5
+
+class ScratchArena {
+    public:
+    uint8_t buf[SCRATCH_ARENA_LEN];
+    uint16_t used;
+    uint16_t peak;
+    uint16_t shortfalls;        // requests cut short, saturating
+    char spill;                 // handed out when the arena is full
+
+    uint16_t available() const {
+        return SCRATCH_ARENA_LEN - used;
+    }
+};
+
+ScratchArena scratch_arena;
+
+class ScratchBuffer {
+    public:
+    char* data;
+    uint16_t len;
+
+    ScratchBuffer(const uint16_t want) {
+        ScratchArena& arena = scratch_arena;
+        mark = arena.used;
+        len = want;
+        if (len > arena.available()) {
+            len = arena.available();
+            if (arena.shortfalls < 0xFFFF) arena.shortfalls++;
+        }
+        if (len == 0) {
+            arena.spill = '\0';
+            data = &arena.spill;
+            len = 1;
+            return;
+        }
+        data = (char*) arena.buf + mark;
+        arena.used += len;
+        if (arena.used > arena.peak) arena.peak = arena.used;
+    }
+    ~ScratchBuffer() {
+        // Buffers are released in reverse order, so this frees
+        // everything taken since
+        scratch_arena.used = mark;
+    }
+
+    private:
+    uint16_t mark;
+    // Copying would release the space twice
+    ScratchBuffer(const ScratchBuffer&);
+    ScratchBuffer& operator=(const ScratchBuffer&);
+};
+
+#ifdef __AVR__
+extern uint8_t _end;        // end of .data and .bss
+extern uint8_t __stack;     // RAMEND
+extern char* __brkval;      // heap top, 0 until malloc() is first called
+
+// Runs from .init1, before the stack pointer is even set up, so it can't
+// use the compiler's registers or the stack
+void paint_stack(void) __attribute__((naked, used, section(".init1")));
+void paint_stack(void) {
+    __asm volatile("    ldi r30, lo8(_end)\n"
+                   "    ldi r31, hi8(_end)\n"
+                   "    ldi r24, %0\n"
+                   "    ldi r25, hi8(__stack)\n"
+                   "    rjmp 2f\n"
+                   "1:  st Z+, r24\n"
+                   "2:  cpi r30, lo8(__stack)\n"
+                   "    cpc r31, r25\n"
+                   "    brlo 1b\n"
+                   "    breq 1b\n"
+                   :: "M" (STACK_CANARY));
+}
+
+inline uint16_t sram_free_now() {
+    // Between the top of the heap (or static data) and the stack
+    uint8_t here;
+    const uint8_t* heap_top = __brkval ? (const uint8_t*) __brkval : &_end;
+    return &here - heap_top;
+}
+
+inline uint16_t sram_never_used() {
+    // Canary bytes the stack has never reached down to
+    const uint8_t* p = __brkval ? (const uint8_t*) __brkval : &_end;
+    uint16_t untouched = 0;
+    while (p <= &__stack && *p == STACK_CANARY) {
+        p++;
+        untouched++;
+    }
+    return untouched;
+}
+
+inline uint16_t sram_stack_peak() {
+    // Deepest the stack has been, counting the first byte that differs
+    // from the canary as used
+    const uint8_t* p = __brkval ? (const uint8_t*) __brkval : &_end;
+    return &__stack - p + 1 - sram_never_used();
+}
+
+inline uint16_t sram_static_size() {
+    return &_end - (uint8_t*) RAMSTART;
+}
+#endif
+
+#endif
@@ -0,0 +1,81 @@
+/* Link and firmware health counters since boot.
+ *
+ * Most counters live with whatever they count (the frame decoders, the
+ * receive rings, the BLE notifier, the scheduler); collect() gathers them
+ * into one fixed 20 byte block so the stats command can report them in
+ * any build, over USB or BLE UART. Counters wrap or saturate at 16 bits.
+ *
+ * Part of the PeloMon project. See the accompanying blog post at
+ * https://ihaque.org/posts/2021/01/04/pelomon-part-iv-software/
+ *
+ * Copyright 2020 Imran S Haque (imran@ihaque.org)
+ * Licensed under the CC-BY-NC 4.0 license
+ * (https://creativecommons.org/licenses/by-nc/4.0/).
+ */
+#ifndef _STATS_H_
+#define _STATS_H_
+
+struct HealthStats {
+    uint16_t hu_frames;         // valid frames per direction
+    uint16_t bike_frames;
+    uint16_t bad_header;        // stray bytes, truncated or unterminated frames
+    uint16_t bad_length;
+    uint16_t bad_checksum;
+    uint16_t bad_digits;        // bike payload not a 16 bit decimal
+    uint16_t bike_timeouts;
+    uint16_t rx_overflows;      // bytes lost to a full receive ring
+    uint16_t ble_errors;        // failed characteristic writes
+    uint16_t overruns;          // tasks over budget or past deadline
+};
+
+class HealthMonitor {
+    public:
+    HealthStats stats;
+    // Since boot; link_counters.timed_out counts the same pairs but
+    // restarts with each stress run
+    uint16_t bike_timeouts;
+
+    void initialize() {
+        memset(&stats, 0, sizeof(stats));
+        bike_timeouts = 0;
+    }
+    void collect(const FrameCounters& hu, const FrameCounters& bike,
+                 const uint16_t rx_overflows, const uint16_t ble_errors,
+                 const uint16_t overruns) {
+        stats.hu_frames = hu.frames;
+        stats.bike_frames = bike.frames;
+        stats.bad_header = hu.skipped + hu.truncated + hu.bad_terminator +
+                           bike.skipped + bike.truncated + bike.bad_terminator;
+        stats.bad_length = hu.bad_length + bike.bad_length;
+        stats.bad_checksum = hu.bad_checksum + bike.bad_checksum;
+        stats.bad_digits = bike.bad_digits;
+        stats.bike_timeouts = bike_timeouts;
+        stats.rx_overflows = rx_overflows;
+        stats.ble_errors = ble_errors;
+        stats.overruns = overruns;
+    }
+    void dump(Logger& logger, const uint16_t log_dropped) const {
+        char buf[48];
+        snprintf_P(buf, 48, PSTR("Up %lus\nframes hu %u bike %u\n"),
+                   millis() / 1000, stats.hu_frames, stats.bike_frames);
+        logger.print(buf);
+        snprintf_P(buf, 48, PSTR("bad header %u length %u\n"),
+                   stats.bad_header, stats.bad_length);
+        logger.print(buf);
+        snprintf_P(buf, 48, PSTR("bad checksum %u digits %u\n"),
+                   stats.bad_checksum, stats.bad_digits);
+        logger.print(buf);
+        snprintf_P(buf, 48, PSTR("bike timeouts %u rx overflows %u\n"),
+                   stats.bike_timeouts, stats.rx_overflows);
+        logger.print(buf);
+        snprintf_P(buf, 48, PSTR("ble errors %u overruns %u\n"),
+                   stats.ble_errors, stats.overruns);
+        logger.print(buf);
+        snprintf_P(buf, 48, PSTR("log dropped %u\n"), log_dropped);
+        logger.print(buf);
+    }
+};
+
+HealthMonitor health;
+
+#endif